@@ -93,6 +93,8 @@ QtObject {
 			return createColor(config, result)
 		else if(config.type == "progress")
 			return createProgress(config, result)
+		else if(config.type == "notification")
+			return createNotification(config, result)
 		else
 			return false;
 	}
@@ -118,96 +120,37 @@ QtObject {
 			return false;
 	}
 
-	//! Internal property
-	property var _popups: []
-	//! Internal property
-	property Component _msgBoxComponent: MsgBox {
-		id: __msgBox
-
-		onClosed: {
-			var index = _popups.indexOf(__msgBox);
-			if(index > -1) {
-				__msgBox.destroy();
-				_dialogPresenter._popups.splice(index, 1);
-			}
-		}
-
-		Component.onCompleted: {
-			_popups.push(__msgBox)
-			__msgBox.open()
-		}
+	/*! @brief Prefetches the components of the given dialog types
+	 *
+	 * @param type:string[] types The dialog types to prefetch. Can be `"msgbox"`, `"input"`,
+	 * `"file"`, `"folder"` and `"progress"`. If not specified, all of them are prefetched
+	 *
+	 * The dialog components are not part of the presenter itself, but are only compiled on
+	 * their first use. Call this method once the application is idle, i.e. after the first
+	 * frame was shown, to compile them in the background, so the first dialog of a type does
+	 * not have to wait for it. QtMvvmApp does this automatically.
+	 *
+	 * @sa QtMvvmApp::warmUp
+	 */
+	function warmUp(types) {
+		if(typeof types == "undefined")
+			types = ["msgbox", "input", "file", "folder", "progress"];
+		for(var i = 0; i < types.length; i++)
+			_component(types[i], Component.Asynchronous);
 	}
 
 	//! Internal property
-	property Component _inputComponent: InputDialog {
-		id: __input
-
-		onClosed: {
-			var index = _popups.indexOf(__input);
-			if(index > -1) {
-				__input.destroy();
-				_dialogPresenter._popups.splice(index, 1);
-			}
-		}
-
-		Component.onCompleted: {
-			_popups.push(__input)
-			__input.open()
-		}
-	}
-
+	property var _popups: []
 	//! Internal property
-	property Component _fileComponent: FileDialog {
-		id: __file
-
-		onClosed: {
-			var index = _popups.indexOf(__file);
-			if(index > -1) {
-				__file.destroy();
-				_dialogPresenter._popups.splice(index, 1);
-			}
-		}
-
-		Component.onCompleted: {
-			_popups.push(__file)
-			__file.open()
-		}
-	}
+	property var _components: ({})
 
 	//! Internal property
-	property Component _folderComponent: FolderDialog {
-		id: __folder
-
-		onClosed: {
-			var index = _popups.indexOf(__folder);
-			if(index > -1) {
-				__folder.destroy();
-				_dialogPresenter._popups.splice(index, 1);
-			}
-		}
-
-		Component.onCompleted: {
-			_popups.push(__folder)
-			__folder.open()
-		}
-	}
-
+	property ToolTip _notification: null
 	//! Internal property
-	property Component _progressComponent: ProgressDialog {
-		id: __progress
-
-		onClosed: {
-			var index = _popups.indexOf(__progress);
-			if(index > -1) {
-				__progress.destroy();
-				_dialogPresenter._popups.splice(index, 1);
-			}
-		}
-
-		Component.onCompleted: {
-			_popups.push(__progress)
-			__progress.open()
-		}
+	property Component _notificationComponent: ToolTip {
+		x: (parent.width - width) / 2
+		y: parent.height - height - 48
+		closePolicy: Popup.NoAutoClose
 	}
 
 	/*! @brief Method present a dialog of the QtMvvm::MessageConfig::TypeMessageBox
@@ -226,8 +169,7 @@ QtObject {
 		var props = config.viewProperties;
 		props["msgConfig"] = config;
 		props["msgResult"] = result;
-		var incubator = _msgBoxComponent.incubateObject(rootItem, props, Qt.Synchronous);
-		return incubator.status !== Component.Error;
+		return _present("msgbox", props);
 	}
 
 	/*! @brief Method present a dialog of the QtMvvm::MessageConfig::TypeInputDialog
@@ -246,8 +188,7 @@ QtObject {
 		var props = config.viewProperties;
 		props["msgConfig"] = config;
 		props["msgResult"] = result;
-		var incubator = _inputComponent.incubateObject(rootItem, props, Qt.Synchronous);
-		return incubator.status !== Component.Error;
+		return _present("input", props);
 	}
 
 	/*! @brief Method present a dialog of the QtMvvm::MessageConfig::TypeFileDialog
@@ -266,12 +207,7 @@ QtObject {
 		var props = config.viewProperties;
 		props["msgConfig"] = config;
 		props["msgResult"] = result;
-		var incubator = null;
-		if(config.subType == "folder")
-			incubator = _folderComponent.incubateObject(rootItem, props, Qt.Synchronous);
-		else
-			incubator = _fileComponent.incubateObject(rootItem, props, Qt.Synchronous);
-		return incubator.status !== Component.Error;
+		return _present(config.subType == "folder" ? "folder" : "file", props);
 	}
 
 	/*! @brief Method present a dialog of the QtMvvm::MessageConfig::TypeColorDialog
@@ -309,7 +245,110 @@ QtObject {
 		var props = config.viewProperties;
 		props["msgConfig"] = config;
 		props["msgResult"] = result;
-		var incubator = _progressComponent.incubateObject(rootItem, props, Qt.Synchronous);
-		return incubator.status !== Component.Error;
+		return _present("progress", props);
+	}
+
+	/*! @brief Method present a notification of the QtMvvm::MessageConfig::TypeNotification
+	 *
+	 * @param type:MessageConfig config The message configuration to create a notification of
+	 * @param type:MessageResult result The result to report the notification result to
+	 * @return type:bool `true` if successfully presented, `false` if not
+	 *
+	 * Used by the showDialog() method to show a notification as a tooltip at the bottom of the
+	 * root item. Only one notification is visible at a time, a new one replaces the current
+	 * one. Notifications are not added to the open dialogs and are completed right away.
+	 *
+	 * @sa DialogPresenter::showDialog
+	 */
+	function createNotification(config, result) {
+		if(!_notification) {
+			var incubator = _notificationComponent.incubateObject(rootItem, {}, Qt.Synchronous);
+			if(incubator.status === Component.Error)
+				return false;
+			_notification = incubator.object;
+		}
+
+		var props = config.viewProperties;
+		var text = config.title != "" ? qsTr("%1: %2").arg(config.title).arg(config.text) : config.text;
+		if(typeof props["repeatCount"] == "number" && props["repeatCount"] > 1)
+			text = qsTr("%1 (x%L2)").arg(text).arg(props["repeatCount"]);
+		_notification.timeout = typeof props["timeout"] == "number" ? props["timeout"] : 3000;
+		_notification.text = text;
+		_notification.open();
+		result.complete(MessageConfig.NoButton);
+		return true;
+	}
+
+	//! Internal method
+	function _componentUrl(type) {
+		if(type == "msgbox")
+			return Qt.resolvedUrl("MsgBox.qml");
+		else if(type == "input")
+			return Qt.resolvedUrl("InputDialog.qml");
+		else if(type == "progress")
+			return Qt.resolvedUrl("ProgressDialog.qml");
+		// file dialogs are registered from the resources, see the plugin
+		else if(type == "file")
+			return Qt.platform.os == "android" ?
+						"qrc:/de/skycoder42/qtmvvm/quick/qml/AndroidFileDialog.qml" :
+						"qrc:/de/skycoder42/qtmvvm/quick/qml/FileDialog.qml";
+		else if(type == "folder")
+			return Qt.platform.os == "android" ?
+						"qrc:/de/skycoder42/qtmvvm/quick/qml/AndroidFolderDialog.qml" :
+						"qrc:/de/skycoder42/qtmvvm/quick/qml/FolderDialog.qml";
+		else
+			return "";
+	}
+
+	//! Internal method
+	function _component(type, mode) {
+		var component = _components[type];
+		if(!component) {
+			component = Qt.createComponent(_componentUrl(type), mode, _dialogPresenter);
+			_components[type] = component;
+		}
+		return component;
+	}
+
+	//! Internal method
+	function _present(type, props) {
+		var component = _component(type, Component.PreferSynchronous);
+		if(component.status !== Component.Loading)
+			return _incubate(component, props);
+
+		// still compiling from a warm up, show it as soon as it is done
+		var onStatusChanged = function(status) {
+			if(status === Component.Loading)
+				return;
+			component.statusChanged.disconnect(onStatusChanged);
+			if(!_incubate(component, props))
+				props["msgResult"].complete(MessageConfig.NoButton);
+		};
+		component.statusChanged.connect(onStatusChanged);
+		return true;
+	}
+
+	//! Internal method
+	function _incubate(component, props) {
+		if(component.status !== Component.Ready) {
+			console.warn("Failed to load dialog component:", component.errorString());
+			return false;
+		}
+
+		var incubator = component.incubateObject(rootItem, props, Qt.Synchronous);
+		if(incubator.status === Component.Error)
+			return false;
+
+		var popup = incubator.object;
+		popup.closed.connect(function() {
+			var index = _popups.indexOf(popup);
+			if(index > -1) {
+				popup.destroy();
+				_dialogPresenter._popups.splice(index, 1);
+			}
+		});
+		_popups.push(popup);
+		popup.open();
+		return true;
 	}
 }
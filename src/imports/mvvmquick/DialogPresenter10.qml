@@ -73,6 +73,8 @@ QtObject {
 			return createInput(config, result)
 		else if(config.type == "file")
 			return createFile(config, result)
+		else if(config.type == "notification")
+			return createNotification(config, result)
 		else
 			return false;
 	}
@@ -168,6 +170,15 @@ QtObject {
 		}
 	}
 
+	//! Internal property
+	property ToolTip _notification: null
+	//! Internal property
+	property Component _notificationComponent: ToolTip {
+		x: (parent.width - width) / 2
+		y: parent.height - height - 48
+		closePolicy: Popup.NoAutoClose
+	}
+
 	/*! @brief Method present a dialog of the QtMvvm::MessageConfig::TypeMessageBox
 	 *
 	 * @param type:MessageConfig config The message configuration to create a dialog of
@@ -231,4 +242,35 @@ QtObject {
 			incubator = _fileComponent.incubateObject(rootItem, props, Qt.Synchronous);
 		return incubator.status !== Component.Error;
 	}
+
+	/*! @brief Method present a notification of the QtMvvm::MessageConfig::TypeNotification
+	 *
+	 * @param type:MessageConfig config The message configuration to create a notification of
+	 * @param type:MessageResult result The result to report the notification result to
+	 * @return type:bool `true` if successfully presented, `false` if not
+	 *
+	 * Used by the showDialog() method to show a notification as a tooltip at the bottom of the
+	 * root item. Only one notification is visible at a time, a new one replaces the current
+	 * one. Notifications are not added to the open dialogs and are completed right away.
+	 *
+	 * @sa DialogPresenter::showDialog
+	 */
+	function createNotification(config, result) {
+		if(!_notification) {
+			var incubator = _notificationComponent.incubateObject(rootItem, {}, Qt.Synchronous);
+			if(incubator.status === Component.Error)
+				return false;
+			_notification = incubator.object;
+		}
+
+		var props = config.viewProperties;
+		var text = config.title != "" ? qsTr("%1: %2").arg(config.title).arg(config.text) : config.text;
+		if(typeof props["repeatCount"] == "number" && props["repeatCount"] > 1)
+			text = qsTr("%1 (x%L2)").arg(text).arg(props["repeatCount"]);
+		_notification.timeout = typeof props["timeout"] == "number" ? props["timeout"] : 3000;
+		_notification.text = text;
+		_notification.open();
+		result.complete(MessageConfig.NoButton);
+		return true;
+	}
 }
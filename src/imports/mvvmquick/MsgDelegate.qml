@@ -22,6 +22,7 @@ import de.skycoder42.QtMvvm.Quick 1.1
  * - title
  * - tooltip
  * - delegateUrl
+ * - delegateComponent
  * - inputValue
  * - properties
  * - preview
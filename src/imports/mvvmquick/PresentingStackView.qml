@@ -1,5 +1,6 @@
 import QtQuick 2.10
 import QtQuick.Controls 2.3
+import de.skycoder42.QtMvvm.Quick 1.1
 
 /*! @brief A presentation helper that can present standard mvvm views
  *
@@ -67,10 +68,35 @@ StackView {
 	 * @sa animDuration
 	 */
 	property int opDuration: 75
+	/*! @brief The number of hidden views that stay loaded below the current one
+	 *
+	 * @default{`-1`}
+	 *
+	 * If set to a value of `0` or greater, the item trees of views that are further down the
+	 * stack are destroyed to save memory. Only their viewmodels are kept alive. Once the user
+	 * navigates back to such a view, it is recreated from its url and gets the same viewmodel
+	 * again. A value of `-1` keeps all views loaded.
+	 *
+	 * @note To make this possible, presented views are placed into an internal page item, so
+	 * the attached StackView properties of the view itself are not updated. Views that are not
+	 * created from a url or do not have a viewModel are never unloaded. Views that other views
+	 * have been presented into stay loaded as long as those child views exist, as only the view
+	 * itself could be restored.
+	 *
+	 * @accessors{
+	 *	@memberAc{keepLoadedDepth}
+	 *  @notifyAc{keepLoadedDepthChanged()}
+	 * }
+	 */
+	property int keepLoadedDepth: -1
 
 	//! Internal property
 	property var _clearItems: []
 
+	onKeepLoadedDepthChanged: Qt.callLater(_unloadHiddenPages)
+	onDepthChanged: Qt.callLater(_unloadHiddenPages)
+	onBusyChanged: Qt.callLater(_unloadHiddenPages)
+
 	/*! @brief The primary presenting method to present a view
 	 *
 	 * @param type:Item item The item to be presented
@@ -84,13 +110,14 @@ StackView {
 	 * @sa QtMvvmApp::presentItem, @ref QtQuick.Item "Item"
 	 */
 	function presentItem(item) {
+		var page = _wrapPage(item);
 		if(typeof item.presentAsRoot == "boolean" && item.presentAsRoot) {
-			if(safeReplace(null, item))
+			if(safeReplace(null, page))
 				return true;
 			else
 				return false;
 		} else {
-			if(push(item))
+			if(push(page))
 				return true;
 			else
 				return false;
@@ -178,6 +205,86 @@ StackView {
 		_clearItems = [];
 	}
 
+	//! Internal method
+	function _wrapPage(item) {
+		if(keepLoadedDepth < 0 || !item.viewModel)
+			return item;
+		var url = QuickPresenter.viewUrl(item);
+		if(url == "")
+			return item;
+		return _pageComponent.createObject(_presenterStack, {
+											   viewUrl: url,
+											   viewModel: item.viewModel,
+											   view: item
+										   });
+	}
+
+	//! Internal method
+	function _unloadHiddenPages() {
+		if(keepLoadedDepth < 0 || busy)
+			return;
+		for(var i = depth - keepLoadedDepth - 2; i >= 0; i--) {
+			var page = get(i, StackView.DontLoad);
+			if(page && page._isLoadablePage)
+				page.unload();
+		}
+	}
+
+	Component {
+		id: _pageComponent
+
+		Item {
+			id: _page
+
+			readonly property bool _isLoadablePage: true
+			property url viewUrl
+			property var viewModel: null
+			property Item view: null
+
+			onViewChanged: {
+				if(view) {
+					view.parent = _page;
+					view.anchors.fill = _page;
+				}
+			}
+
+			function closeAction() {
+				if(view && typeof view.closeAction == "function")
+					return view.closeAction();
+				else
+					return false;
+			}
+
+			function afterPop() {
+				if(view && typeof view.afterPop == "function")
+					view.afterPop();
+			}
+
+			function unload() {
+				if(!view)
+					return;
+				var released = QuickPresenter.releaseView(view, _page);
+				if(!released) // hosts child views, that cannot be restored
+					return;
+				viewModel = released;
+				view = null;
+			}
+
+			function reload() {
+				if(view || !viewModel)
+					return;
+				view = QuickPresenter.restoreView(viewUrl, viewModel);
+			}
+
+			StackView.onActivating: reload()
+
+			Component.onDestruction: {
+				if(view)
+					view.destroy();
+			}
+		}
+	}
+
 	pushEnter: Transition {
 		PropertyAnimation {
 			property: "y"
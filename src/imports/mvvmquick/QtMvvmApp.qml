@@ -53,6 +53,22 @@ ApplicationWindow {
 	 * @sa QtMvvmApp::presentDrawerContent, QtMvvmApp::drawer, QtMvvmApp::presentItem
 	 */
 	property bool rootOnlyDrawer: true
+	/*! @brief Specifies if the dialogs are prefetched as soon as the application is idle
+	 *
+	 * @default{`true`}
+	 *
+	 * If set to `true`, warmUp() is called right after the app was completed and the event
+	 * loop is idle again. Set it to `false` to only compile the dialogs when they are first
+	 * shown, or to call warmUp() yourself at a later point.
+	 *
+	 * @accessors{
+	 *	@memberAc{warmUpOnIdle}
+	 *  @notifyAc{warmUpOnIdleChanged()}
+	 * }
+	 *
+	 * @sa QtMvvmApp::warmUp, DialogPresenter::warmUp
+	 */
+	property bool warmUpOnIdle: true
 
 	PresenterProgress {
 		id: _rootProgress
@@ -64,15 +80,19 @@ ApplicationWindow {
 		anchors.fill: parent
 	}
 
+	// loaded by url, so the drawer is only compiled once it is first used
 	Loader {
 		id: _drawerLoader
 		active: false
 		asynchronous: false
-		sourceComponent: PresentingDrawer {
-			id: _rootDrawer
+		source: Qt.resolvedUrl("PresentingDrawer.qml")
+	}
 
-			interactive: !_root.rootOnlyDrawer || _rootStack.depth == 1
-		}
+	Binding {
+		target: _drawerLoader.item
+		property: "interactive"
+		value: !_root.rootOnlyDrawer || _rootStack.depth == 1
+		when: _drawerLoader.item !== null
 	}
 
 	PopupPresenter {
@@ -141,6 +161,17 @@ ApplicationWindow {
 		return _rootDialogs.showDialog(config, result);
 	}
 
+	/*! @brief Prefetches the components of all dialogs in the background
+	 *
+	 * Calls DialogPresenter::warmUp on the internally used dialog presenter. This is done
+	 * automatically if warmUpOnIdle is `true`.
+	 *
+	 * @sa QtMvvmApp::warmUpOnIdle, DialogPresenter::warmUp
+	 */
+	function warmUp() {
+		_rootDialogs.warmUp();
+	}
+
 	//! @copybrief PresentingDrawer::toggle
 	function toggleDrawer() {
 		if(_drawerLoader.item)
@@ -178,7 +209,11 @@ ApplicationWindow {
 		return closed;
 	}
 
-	Component.onCompleted: QuickPresenter.qmlPresenter = _root
+	Component.onCompleted: {
+		QuickPresenter.qmlPresenter = _root;
+		if(warmUpOnIdle)
+			Qt.callLater(warmUp);
+	}
 
 	onClosing: close.accepted = !closeAction();
 }
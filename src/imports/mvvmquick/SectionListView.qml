@@ -14,19 +14,86 @@ ListView {
 		title: section
 	}
 
-	delegate: Loader {
-		id: loaderDelegate
-		width: parent.width
-		height: item ? item.implicitHeight : 0
-
-		onLoaded: {
-			if(loaderDelegate.item && typeof loaderDelegate.item.showInput !== "undefined") {
-				loaderDelegate.item.showInput.connect(function(key, title, type, defaultValue, props){
-					builder.showDialog(key, title, type, defaultValue, props);
-				});
+	// delegate pooling is only available since Qt 5.15
+	Component.onCompleted: {
+		if(typeof _listView.reuseItems !== "undefined")
+			_listView.reuseItems = true;
+	}
+
+	delegate: Item {
+		id: _rowDelegate
+		width: _listView.width
+		height: loaderDelegate.item ? loaderDelegate.item.implicitHeight : _placeholder.implicitHeight
+
+		// mirrors of the roles, to reload the row when it is reused for a different entry
+		readonly property Component entryComponent: delegateComponent
+		readonly property url entryUrl: delegateUrl
+		readonly property var entryProperties: properties
+		// the keys set on the current item, keys missing in the next entry would keep their values
+		property var appliedKeys: []
+
+		onEntryComponentChanged: loadDelegate()
+		onEntryUrlChanged: loadDelegate()
+		onEntryPropertiesChanged: applyProperties()
+
+		function loadDelegate() {
+			if(entryComponent)
+				loaderDelegate.sourceComponent = entryComponent;
+			else // no engine to precompile the delegates in
+				loaderDelegate.setSource(entryUrl, entryProperties);
+		}
+
+		function reloadDelegate() {
+			loaderDelegate.sourceComponent = undefined;
+			loadDelegate();
+		}
+
+		function applyProperties() {
+			if(!loaderDelegate.item)
+				return;
+			for(var i = 0; i < appliedKeys.length; i++) {
+				if(!entryProperties || !(appliedKeys[i] in entryProperties)) {
+					// the defaults are only known to the delegate, so it is created again
+					reloadDelegate();
+					return;
+				}
+			}
+
+			var keys = [];
+			for(var key in entryProperties) {
+				if(key in loaderDelegate.item) {
+					loaderDelegate.item[key] = entryProperties[key];
+					keys.push(key);
+				}
+			}
+			appliedKeys = keys;
+		}
+
+		ItemDelegate {
+			id: _placeholder
+			width: parent.width
+			visible: loaderDelegate.status !== Loader.Ready
+			hoverEnabled: false
+			text: title
+		}
+
+		Loader {
+			id: loaderDelegate
+			width: parent.width
+			height: item ? item.implicitHeight : 0
+			asynchronous: true
+
+			onLoaded: {
+				_rowDelegate.appliedKeys = [];
+				_rowDelegate.applyProperties();
+				if(loaderDelegate.item && typeof loaderDelegate.item.showInput !== "undefined") {
+					loaderDelegate.item.showInput.connect(function(key, title, type, defaultValue, props){
+						builder.showDialog(key, title, type, defaultValue, props);
+					});
+				}
 			}
 		}
 
-		Component.onCompleted: loaderDelegate.setSource(delegateUrl, properties);
+		Component.onCompleted: loadDelegate()
 	}
 }
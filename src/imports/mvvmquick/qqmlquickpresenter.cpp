@@ -6,6 +6,10 @@
 
 #include <QtQuickControls2/QQuickStyle>
 
+#include <QtCore/private/qmetaobject_p.h>
+
+#include <QtMvvmCore/FlightRecorder>
+#include <QtMvvmCore/StallDetector>
 #include <QtMvvmCore/private/qtmvvm_logging_p.h>
 #include <QtMvvmQuick/private/quickpresenter_p.h>
 
@@ -15,6 +19,19 @@
 
 using namespace QtMvvm;
 
+namespace {
+
+// QML objects have dynamic meta objects that are freed with the instance, the recorder needs one that lives forever
+const QMetaObject *recordedMetaObject(const QObject *object)
+{
+	auto metaObject = object->metaObject();
+	while(metaObject && (QMetaObjectPrivate::get(metaObject)->flags & DynamicMetaObject))
+		metaObject = metaObject->superClass();
+	return metaObject;
+}
+
+}
+
 QQmlQuickPresenter::QQmlQuickPresenter(QQmlEngine *engine) :
 	QObject{engine},
 	_engine{engine}
@@ -22,6 +39,8 @@ QQmlQuickPresenter::QQmlQuickPresenter(QQmlEngine *engine) :
 	QuickPresenterPrivate::setQmlPresenter(this);
 	connect(QuickPresenterPrivate::currentPresenter(), &QuickPresenter::inputViewFactoryChanged,
 			this, &QQmlQuickPresenter::inputViewFactoryChanged);
+	connect(this, &QQmlQuickPresenter::qmlPresenterChanged,
+			this, &QQmlQuickPresenter::updateQmlPresenterMethods);
 }
 
 QString QQmlQuickPresenter::currentStyle() const
@@ -71,6 +90,64 @@ QColor QQmlQuickPresenter::accentTextColor(const QColor &accentColor, const QCol
 		return Qt::black;
 }
 
+QUrl QQmlQuickPresenter::viewUrl(QQuickItem *view) const
+{
+	auto context = qmlContext(view);
+	return context ? context->baseUrl() : QUrl{};
+}
+
+ViewModel *QQmlQuickPresenter::releaseView(QQuickItem *view, QObject *keeper)
+{
+	if(!view)
+		return nullptr;
+	auto viewModel = view->property("viewModel").value<ViewModel*>();
+	// only the view itself can be restored, child views presented into it would be lost
+	if(!viewModel || hostsChildViews(view, viewModel))
+		return nullptr;
+	// keep the viewmodel alive without the view, so it can be restored later
+	if(viewModel->parent() == view)
+		viewModel->setParent(keeper);
+	view->deleteLater();
+	return viewModel;
+}
+
+QQuickItem *QQmlQuickPresenter::restoreView(const QUrl &viewUrl, ViewModel *viewModel)
+{
+	if(!viewModel)
+		return nullptr;
+
+	// the component is typically still cached from the first time the view was presented
+	QSharedPointer<QQmlComponent> component;
+	auto cached = _componentCache.object(viewUrl);
+	if(cached && (*cached)->isReady())
+		component = *cached;
+	else
+		component.reset(new QQmlComponent{_engine, viewUrl});
+	if(!component->isReady()) {
+		logWarning().noquote() << "Failed to restore view" << viewUrl
+							   << "with error:" << component->errorString().trimmed();
+		return nullptr;
+	}
+
+	auto object = component->beginCreate(_engine->rootContext());
+	auto item = qobject_cast<QQuickItem*>(object);
+	if(!item) {
+		logWarning() << "Unable to restore quick view from the component" << viewUrl;
+		if(object) {
+			component->completeCreate();
+			object->deleteLater();
+		}
+		return nullptr;
+	}
+	FlightRecorder::record(FlightRecorder::ViewCreated, recordedMetaObject(item));
+	// same as for a new view, but without initializing the viewmodel again
+	item->setProperty("viewModel", QVariant::fromValue(viewModel));
+	viewModel->setParent(item);
+	component->completeCreate();
+	QQmlEngine::setObjectOwnership(item, QQmlEngine::JavaScriptOwnership);
+	return item;
+}
+
 void QQmlQuickPresenter::toggleDrawer()
 {
 	if(!_qmlPresenter) {
@@ -78,7 +155,7 @@ void QQmlQuickPresenter::toggleDrawer()
 		return;
 	}
 
-	if(!QMetaObject::invokeMethod(_qmlPresenter, "toggleDrawer"))
+	if(!_toggleDrawerMethod.invoke(_qmlPresenter))
 		logWarning() << "QML-Presenter does not have a \"toggleDrawer\" method";
 }
 
@@ -89,7 +166,7 @@ void QQmlQuickPresenter::popView()
 		return;
 	}
 
-	if(!QMetaObject::invokeMethod(_qmlPresenter, "closeAction"))
+	if(!_closeActionMethod.invoke(_qmlPresenter))
 		logWarning() << "QML-Presenter does not have a \"closeAction\" method";
 }
 
@@ -150,10 +227,10 @@ void QQmlQuickPresenter::showDialog(const MessageConfig &config, MessageResult *
 	}
 
 	QVariant res = false;
-	QMetaObject::invokeMethod(_qmlPresenter, "showDialog", Qt::DirectConnection,
-							  Q_RETURN_ARG(QVariant, res),
-							  Q_ARG(QVariant, QVariant::fromValue(config)),
-							  Q_ARG(QVariant, QVariant::fromValue(result)));
+	_showDialogMethod.invoke(_qmlPresenter, Qt::DirectConnection,
+							 Q_RETURN_ARG(QVariant, res),
+							 Q_ARG(QVariant, QVariant::fromValue(config)),
+							 Q_ARG(QVariant, QVariant::fromValue(result)));
 	if(!res.toBool()) {
 		logWarning() << "Failed to present dialog of type"
 					 << config.type();
@@ -193,6 +270,22 @@ void QQmlQuickPresenter::statusChanged(QQmlComponent::Status status)
 	processShowQueue();
 }
 
+void QQmlQuickPresenter::updateQmlPresenterMethods()
+{
+	// resolve the methods once instead of looking them up by name for every call
+	if(_qmlPresenter) {
+		auto meta = _qmlPresenter->metaObject();
+		_showDialogMethod = meta->method(meta->indexOfMethod("showDialog(QVariant,QVariant)"));
+		_toggleDrawerMethod = meta->method(meta->indexOfMethod("toggleDrawer()"));
+		_closeActionMethod = meta->method(meta->indexOfMethod("closeAction()"));
+	} else {
+		_showDialogMethod = QMetaMethod{};
+		_toggleDrawerMethod = QMetaMethod{};
+		_closeActionMethod = QMetaMethod{};
+	}
+	QuickPresenterPrivate::clearPresentMethodCache();
+}
+
 void QQmlQuickPresenter::processShowQueue()
 {
 	while(!_loadQueue.isEmpty()) {
@@ -220,6 +313,7 @@ void QQmlQuickPresenter::addObject(QQmlComponent *component, ViewModel *viewMode
 		return;
 	}
 
+	StallDetector::Scope stallScope{StallDetector::ViewCreation, viewModel->metaObject()->className()};
 	//create the view item, set initial stuff and them complete creation
 	auto item = component->beginCreate(_engine->rootContext());
 	if(!item) {
@@ -227,6 +321,7 @@ void QQmlQuickPresenter::addObject(QQmlComponent *component, ViewModel *viewMode
 					 << component->url();
 		return;
 	}
+	FlightRecorder::record(FlightRecorder::ViewCreated, recordedMetaObject(item));
 	item->setProperty("viewModel", QVariant::fromValue(viewModel));
 	viewModel->setParent(item);
 	viewModel->onInit(params);
@@ -250,3 +345,14 @@ void QQmlQuickPresenter::addObject(QQmlComponent *component, ViewModel *viewMode
 		item->deleteLater();
 	}
 }
+
+bool QQmlQuickPresenter::hostsChildViews(QQuickItem *item, ViewModel *viewModel) const
+{
+	for(auto child : item->childItems()) {
+		auto childViewModel = child->property("viewModel").value<ViewModel*>();
+		if((childViewModel && childViewModel != viewModel) ||
+		   hostsChildViews(child, viewModel))
+			return true;
+	}
+	return false;
+}
@@ -7,6 +7,7 @@
 #include <QtCore/QCache>
 #include <QtCore/QVariant>
 #include <QtCore/QPointer>
+#include <QtCore/QMetaMethod>
 #include <QtCore/QUrl>
 #include <QtCore/QQueue>
 #include <QtCore/QSharedPointer>
@@ -15,6 +16,8 @@
 
 #include <QtQml/QQmlComponent>
 
+#include <QtQuick/QQuickItem>
+
 #include <QtMvvmCore/ViewModel>
 #include <QtMvvmCore/Messages>
 
@@ -123,6 +126,13 @@ public:
 	//! @private
 	qreal loadingProgress() const;
 
+	//! @private
+	Q_INVOKABLE QUrl viewUrl(QQuickItem *view) const;
+	//! @private
+	Q_INVOKABLE QtMvvm::ViewModel *releaseView(QQuickItem *view, QObject *keeper);
+	//! @private
+	Q_INVOKABLE QQuickItem *restoreView(const QUrl &viewUrl, QtMvvm::ViewModel *viewModel);
+
 #ifndef DOXYGEN_RUN
 #define static
 #endif
@@ -174,11 +184,15 @@ private Q_SLOTS:
 	void present(QtMvvm::ViewModel *viewModel, const QVariantHash &params, const QUrl &viewUrl, QPointer<QtMvvm::ViewModel> parent);
 	void showDialog(const QtMvvm::MessageConfig &config, QtMvvm::MessageResult *result);
 	void statusChanged(QQmlComponent::Status status);
+	void updateQmlPresenterMethods();
 
 private:
 	using PresentTuple = std::tuple<QSharedPointer<QQmlComponent>, ViewModel*, QVariantHash, QPointer<ViewModel>>;
 	QQmlEngine *_engine;
 	QPointer<QObject> _qmlPresenter;
+	QMetaMethod _showDialogMethod;
+	QMetaMethod _toggleDrawerMethod;
+	QMetaMethod _closeActionMethod;
 
 	QPointer<QQmlComponent> _latestComponent;
 	QCache<QUrl, QSharedPointer<QQmlComponent>> _componentCache;
@@ -186,6 +200,7 @@ private:
 
 	void processShowQueue();
 	void addObject(QQmlComponent *component, ViewModel *viewModel, const QVariantHash &params, const QPointer<ViewModel> &parent);
+	bool hostsChildViews(QQuickItem *item, ViewModel *viewModel) const;
 };
 
 }
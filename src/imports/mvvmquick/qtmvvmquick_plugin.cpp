@@ -3,6 +3,7 @@
 #include <QtQml>
 
 #include <QtMvvmQuick/InputViewFactory>
+#include <QtMvvmQuick/private/listelementsmodel_p.h>
 
 #include "qqmlquickpresenter.h"
 #include "settingsuibuilder.h"
@@ -51,6 +52,7 @@ void QtMvvmQuickDeclarativeModule::registerTypes(const char *uri)
 
 	//Version 1.1
 	qmlRegisterType<QtMvvm::QQmlViewPlaceholder>(uri, 1, 1, "ViewPlaceholder");
+	qmlRegisterType<QtMvvm::ListElementsModel>(uri, 1, 1, "ListElementsModel");
 
 	// Check to make sure no module update is forgotten
 	static_assert(VERSION_MAJOR == 1 && VERSION_MINOR == 1, "QML module version needs to be updated");
@@ -2,6 +2,7 @@
 
 #include <QtCore/QRegularExpression>
 #include <QtMvvmCore/CoreApp>
+#include <QtMvvmCore/private/qtmvvm_logging_p.h>
 
 using namespace QtMvvm;
 
@@ -16,27 +17,55 @@ SettingsEntryModel::SettingsEntryModel(QObject *parent) :
 	QAbstractListModel{parent}
 {}
 
-void SettingsEntryModel::setup(const SettingsElements::Section &section, SettingsViewModel *viewModel, InputViewFactory *factory)
+void SettingsEntryModel::setup(const SettingsElements::FlatSetup &setup, int section, SettingsViewModel *viewModel, InputViewFactory *factory, QQmlEngine *engine)
 {
+	static const QRegularExpression nameRegex(QStringLiteral("&(?!&)"),
+											  QRegularExpression::DontCaptureOption);
+
 	beginResetModel();
+	_setup = setup;
+	// rows of the previous setup may still use them until the reset is done
+	for(const auto &info : qAsConst(_entries)) {
+		if(info.listModel)
+			info.listModel->deleteLater();
+	}
 	_entries.clear();
 	if(_viewModel) {
 		disconnect(_viewModel, &SettingsViewModel::valueChanged,
 				   this, &SettingsEntryModel::entryChanged);
 	}
 	_viewModel = viewModel;
+	if(_factory != factory || _engine != engine) {
+		// rows of the previous setup may still use them until the reset is done
+		for(auto component : qAsConst(_delegateComponents))
+			component->deleteLater();
+		_delegateComponents.clear();
+	}
 	_factory = factory;
+	_engine = engine;
 	connect(_viewModel, &SettingsViewModel::valueChanged,
 			this, &SettingsEntryModel::entryChanged,
 			Qt::QueuedConnection); //to not mess up data changes
 	auto rIndex = 0;
-	for(const auto &group : section.groups) {
-		for(const auto &entry : group.entries) {
+	const auto groups = _setup.sectionGroups(section);
+	for(auto gIndex = groups.begin; gIndex < groups.end; gIndex++) {
+		const auto hasGroup = !_setup.group(gIndex).title.isEmpty();
+		const auto entries = _setup.groupEntries(gIndex);
+		for(auto eIndex = entries.begin; eIndex < entries.end; eIndex++) {
+			const auto &entry = _setup.entry(eIndex);
 			auto url = _factory->getDelegate(entry.type, entry.properties);
-			if(group.title.isEmpty()) // unnamed groups are presented first
-				_entries.insert(rIndex++, EntryInfo{entry, url});
-			else
-				_entries.append(EntryInfo{entry, url, group});
+			loadDelegateComponent(url);
+			auto title = entry.title;
+			if(title.contains(QLatin1Char('&')))
+				title.remove(nameRegex);
+			ListElementsModel *listModel = nullptr;
+			const auto listElements = entry.properties.value(QStringLiteral("listElements"));
+			if(listElements.type() == QVariant::List)
+				listModel = new ListElementsModel{listElements.toList(), this};
+			if(hasGroup)
+				_entries.append(EntryInfo{eIndex, std::move(title), std::move(url), true, listModel});
+			else // unnamed groups are presented first
+				_entries.insert(rIndex++, EntryInfo{eIndex, std::move(title), std::move(url), false, listModel});
 		}
 	}
 	endResetModel();
@@ -64,11 +93,12 @@ QVariant SettingsEntryModel::data(const QModelIndex &index, int role) const
 		return {};
 #endif
 
-	auto entry = _entries.value(index.row());
+	const auto &info = _entries[index.row()];
+	const auto &entry = _setup.entry(info.entry);
 	switch (role) {
 	case Qt::DisplayRole:
 	case TitleRole:
-		return entry.title;
+		return info.title;
 	case KeyRole:
 		return entry.key;
 	case TypeRole:
@@ -76,13 +106,15 @@ QVariant SettingsEntryModel::data(const QModelIndex &index, int role) const
 	case ToolTipRole:
 		return entry.tooltip;
 	case DelegateUrlRole:
-		return entry.delegateUrl;
+		return info.delegateUrl;
+	case DelegateComponentRole:
+		return QVariant::fromValue(_delegateComponents.value(info.delegateUrl));
 	case SettingsValueRole:
 		return readValue(entry);
 	case PropertiesRole:
-		return entry.properties;
+		return readProperties(info, entry);
 	case GroupRole:
-		return entry.group.title;
+		return info.hasGroup ? _setup.group(_setup.entryGroup(info.entry)).title : QString{};
 	case SearchKeysRole:
 		return entry.searchKeys;
 	case PreviewRole:
@@ -94,7 +126,7 @@ QVariant SettingsEntryModel::data(const QModelIndex &index, int role) const
 				return _factory->format(entry.type,
 										preview.toString(),
 										readValue(entry),
-										entry.properties);
+										readProperties(info, entry));
 			}
 		}
 		return QString{};
@@ -115,7 +147,7 @@ bool SettingsEntryModel::setData(const QModelIndex &index, const QVariant &value
 	if(role != SettingsValueRole)
 		return false;
 
-	_viewModel->saveValue(_entries.value(index.row()).key, value);
+	_viewModel->saveValue(_setup.entry(_entries[index.row()].entry).key, value);
 	emit dataChanged(index, index, {SettingsValueRole, PreviewRole});
 	return true;
 }
@@ -129,6 +161,7 @@ QHash<int, QByteArray> SettingsEntryModel::roleNames() const
 		{TitleRole, "title"},
 		{ToolTipRole, "tooltip"},
 		{DelegateUrlRole, "delegateUrl"},
+		{DelegateComponentRole, "delegateComponent"},
 		{SettingsValueRole, "inputValue"},
 		{PropertiesRole, "properties"},
 		{PreviewRole, "preview"}
@@ -147,7 +180,7 @@ Qt::ItemFlags SettingsEntryModel::flags(const QModelIndex &index) const
 void SettingsEntryModel::entryChanged(const QString &key)
 {
 	for(auto i = 0; i < _entries.size(); i++) {
-		if(_entries[i].key == key) {
+		if(_setup.entry(_entries[i].entry).key == key) {
 			auto mIndex = index(i);
 			emit dataChanged(mIndex, mIndex, {SettingsValueRole, PreviewRole});
 			break;
@@ -160,15 +193,38 @@ QVariant SettingsEntryModel::readValue(const SettingsElements::Entry &entry) con
 	return CoreApp::safeCastInputType(entry.type, _viewModel->loadValue(entry.key, entry.defaultValue));
 }
 
+QVariantMap SettingsEntryModel::readProperties(const EntryInfo &info, const SettingsElements::Entry &entry) const
+{
+	if(!info.listModel)
+		return entry.properties;
+	auto properties = entry.properties;
+	properties.insert(QStringLiteral("listElements"), QVariant::fromValue<QObject*>(info.listModel));
+	return properties;
+}
 
-
-SettingsEntryModel::EntryInfo::EntryInfo(SettingsElements::Entry entry, QUrl delegateUrl, SettingsElements::Group group) :
-	Entry(std::move(entry)),
-	delegateUrl(std::move(delegateUrl)),
-	group(std::move(group))
+void SettingsEntryModel::loadDelegateComponent(const QUrl &url)
 {
-	static const QRegularExpression nameRegex(QStringLiteral("&(?!&)"),
-											  QRegularExpression::DontCaptureOption);
-	title.remove(nameRegex);
-	this->group.entries.clear();
+	if(!_engine || _delegateComponents.contains(url))
+		return;
+
+	// compiled in the background, rows wait for it via their loaders
+	auto component = new QQmlComponent{_engine, url, QQmlComponent::Asynchronous, this};
+	connect(component, &QQmlComponent::statusChanged,
+			this, [component](QQmlComponent::Status status) {
+		if(status == QQmlComponent::Error) {
+			logWarning().noquote() << "Failed to load settings delegate" << component->url()
+								   << "with error:" << component->errorString().trimmed();
+		}
+	});
+	_delegateComponents.insert(url, component);
 }
+
+
+
+SettingsEntryModel::EntryInfo::EntryInfo(int entry, QString title, QUrl delegateUrl, bool hasGroup, ListElementsModel *listModel) :
+	entry{entry},
+	title{std::move(title)},
+	delegateUrl{std::move(delegateUrl)},
+	hasGroup{hasGroup},
+	listModel{listModel}
+{}
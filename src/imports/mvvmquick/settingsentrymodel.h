@@ -2,11 +2,17 @@
 #define QTMVVM_SETTINGSENTRYMODEL_H
 
 #include <QtCore/QAbstractListModel>
+#include <QtCore/QVector>
+#include <QtCore/QHash>
+#include <QtCore/QPointer>
+
+#include <QtQml/QQmlComponent>
 
 #include <QtMvvmCore/SettingsViewModel>
 #include <QtMvvmCore/SettingsElements>
 
 #include <QtMvvmQuick/InputViewFactory>
+#include <QtMvvmQuick/private/listelementsmodel_p.h>
 
 namespace QtMvvm {
 
@@ -22,6 +28,7 @@ public:
 		TitleRole,
 		ToolTipRole,
 		DelegateUrlRole,
+		DelegateComponentRole,
 		SettingsValueRole,
 		PropertiesRole,
 		SearchKeysRole,
@@ -34,7 +41,7 @@ public:
 
 	explicit SettingsEntryModel(QObject *parent = nullptr);
 
-	void setup(const SettingsElements::Section &setup, SettingsViewModel *viewModel, InputViewFactory *factory);
+	void setup(const SettingsElements::FlatSetup &setup, int section, SettingsViewModel *viewModel, InputViewFactory *factory, QQmlEngine *engine = nullptr);
 
 	int rowCount(const QModelIndex &parent = QModelIndex()) const override;
 	QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
@@ -46,19 +53,29 @@ private Q_SLOTS:
 	void entryChanged(const QString &key);
 
 private:
-	struct EntryInfo : public SettingsElements::Entry {
-	public:
-		EntryInfo(SettingsElements::Entry entry = {}, QUrl delegateUrl = {}, SettingsElements::Group group = {});
+	struct EntryInfo {
+		EntryInfo(int entry = -1, QString title = {}, QUrl delegateUrl = {}, bool hasGroup = false, ListElementsModel *listModel = nullptr);
 
+		int entry;
+		// the title without mnemonics
+		QString title;
 		QUrl delegateUrl;
-		SettingsElements::Group group;
+		bool hasGroup;
+		// built once from the listElements and shared by the delegate, its preview and the edit dialog
+		ListElementsModel *listModel;
 	};
 
 	SettingsViewModel *_viewModel = nullptr;
 	InputViewFactory *_factory = nullptr;
-	QList<EntryInfo> _entries;
+	SettingsElements::FlatSetup _setup;
+	QVector<EntryInfo> _entries;
+	// one component per distinct delegate url, shared by all rows and kept across sections
+	QPointer<QQmlEngine> _engine;
+	QHash<QUrl, QQmlComponent*> _delegateComponents;
 
 	QVariant readValue(const SettingsElements::Entry &entry) const;
+	QVariantMap readProperties(const EntryInfo &info, const SettingsElements::Entry &entry) const;
+	void loadDelegateComponent(const QUrl &url);
 };
 
 }
@@ -15,19 +15,22 @@ SettingsSectionModel::SettingsSectionModel(QObject *parent) :
 	_hasSections(false)
 {}
 
-void SettingsSectionModel::setup(const SettingsElements::Setup &setup)
+void SettingsSectionModel::setup(const SettingsElements::FlatSetup &setup)
 {
 	beginResetModel();
+	_setup = setup;
 	_sections.clear();
+	_sections.reserve(_setup.sectionCount());
 	_hasSections = false;
 	auto rIndex = 0;
-	for(const auto &category : setup.categories) {
-		if(category.sections.size() == 1) { // single sects are always at the beginning
+	for(auto cIndex = 0; cIndex < _setup.categoryCount(); cIndex++) {
+		const auto sections = _setup.categorySections(cIndex);
+		if(sections.size() == 1) { // single sects are always at the beginning
 			_hasSections = true;
-			_sections.insert(rIndex++, category);
+			_sections.insert(rIndex++, SectionInfo{sections.begin, true, {}});
 		} else {
-			for(const auto &section : category.sections)
-				_sections.append(SectionInfo{section, category});
+			for(auto sIndex = sections.begin; sIndex < sections.end; sIndex++)
+				_sections.append(SectionInfo{sIndex, false, {}});
 		}
 	}
 	endResetModel();
@@ -55,32 +58,37 @@ QVariant SettingsSectionModel::data(const QModelIndex &index, int role) const
 		return {};
 #endif
 
+	const auto &info = _sections[index.row()];
+	const auto &section = _setup.section(info.section);
+	const auto &category = _setup.category(_setup.sectionCategory(info.section));
 	switch (role) {
 	case Qt::DisplayRole:
 	case TitleRole:
-		return _sections.value(index.row()).title;
+		return info.isCategory ? category.title : section.title;
 	case IconRole:
-		return _sections.value(index.row()).icon;
+		return info.isCategory ? category.icon : section.icon;
 	case ToolTipRole:
-		return _sections.value(index.row()).tooltip;
+		return info.isCategory ? category.tooltip : section.tooltip;
 	case CategoryRole:
-		return _sections.value(index.row()).category.title;
+		return info.isCategory ? QString{} : category.title;
 	case SectionRole:
-		return QVariant::fromValue<SettingsElements::Section>(_sections.value(index.row()));
+		return info.section;
 	case ExtraSearchKeysRole:
 	{
-		const auto &section = _sections[index.row()];
-		if(section.searchKeys.isEmpty()) {
-			for(const auto &group : section.groups) {
-				section.searchKeys.append(group.title);
-				for(const auto &entry : group.entries) {
-					section.searchKeys.append(entry.title);
-					section.searchKeys.append(entry.tooltip);
-					section.searchKeys.append(entry.searchKeys);
+		if(info.searchKeys.isEmpty()) {
+			const auto groups = _setup.sectionGroups(info.section);
+			for(auto gIndex = groups.begin; gIndex < groups.end; gIndex++) {
+				info.searchKeys.append(_setup.group(gIndex).title);
+				const auto entries = _setup.groupEntries(gIndex);
+				for(auto eIndex = entries.begin; eIndex < entries.end; eIndex++) {
+					const auto &entry = _setup.entry(eIndex);
+					info.searchKeys.append(entry.title);
+					info.searchKeys.append(entry.tooltip);
+					info.searchKeys.append(entry.searchKeys);
 				}
 			}
 		}
-		return section.searchKeys;
+		return info.searchKeys;
 	}
 	default:
 		return QVariant();
@@ -103,16 +111,3 @@ bool SettingsSectionModel::hasSections() const
 	return _hasSections;
 }
 
-
-
-SettingsSectionModel::SectionInfo::SectionInfo(SettingsElements::Section section, SettingsElements::Category category) :
-	Section(std::move(section)),
-	category(std::move(category))
-{
-	this->category.sections.clear();
-}
-
-SettingsSectionModel::SectionInfo::SectionInfo(const SettingsElements::Category &category) :
-	Section{category.title, category.icon, category.tooltip, category.sections.first().groups, {}, {}},
-	category()
-{}
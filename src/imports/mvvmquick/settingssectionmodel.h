@@ -2,6 +2,7 @@
 #define QTMVVM_SETTINGSSECTIONMODEL_H
 
 #include <QtCore/QAbstractListModel>
+#include <QtCore/QVector>
 
 #include <QtMvvmCore/SettingsElements>
 
@@ -28,7 +29,7 @@ public:
 
 	explicit SettingsSectionModel(QObject *parent = nullptr);
 
-	void setup(const SettingsElements::Setup &setup);
+	void setup(const SettingsElements::FlatSetup &setup);
 
 	int rowCount(const QModelIndex &parent = QModelIndex()) const override;
 	QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
@@ -37,16 +38,15 @@ public:
 	bool hasSections() const;
 
 private:
-	struct SectionInfo : public SettingsElements::Section {
-	public:
-		SectionInfo(SettingsElements::Section section = {}, SettingsElements::Category category = {});
-		SectionInfo(const SettingsElements::Category &category);
-
-		SettingsElements::Category category;
+	struct SectionInfo {
+		int section = -1;
+		// single section categories are presented as the category itself
+		bool isCategory = false;
 		mutable QStringList searchKeys;
 	};
 
-	QList<SectionInfo> _sections;
+	SettingsElements::FlatSetup _setup;
+	QVector<SectionInfo> _sections;
 	bool _hasSections;
 };
 
@@ -7,6 +7,7 @@
 #include <QtMvvmCore/Messages>
 
 #include <QtQml/QQmlInfo>
+#include <QtQml/QQmlEngine>
 
 #include <QtMvvmQuick/private/quickpresenter_p.h>
 
@@ -35,12 +36,12 @@ QString SettingsUiBuilder::filterText() const
 	return _filterText;
 }
 
-void SettingsUiBuilder::loadSection(const SettingsElements::Section &section)
+void SettingsUiBuilder::loadSection(int section)
 {
 	auto inputFactory = QuickPresenterPrivate::currentPresenter()->inputViewFactory();
-	_entryModel->setup(section, _viewModel, inputFactory);
+	_entryModel->setup(_currentSetup, section, _viewModel, inputFactory, qmlEngine(this));
 #ifndef QT_NO_DEBUG
-	qmlDebug(this) << "Loaded section: " << section.title;
+	qmlDebug(this) << "Loaded section: " << _currentSetup.section(section).title;
 #endif
 	emit presentSection(_entryFilterModel);
 }
@@ -88,17 +89,17 @@ void SettingsUiBuilder::startBuildUi()
 	if(!_buildView || !_viewModel)
 		return;
 
-	_currentSetup = _viewModel->loadSetup(QStringLiteral("quick"));
+	_currentSetup = _viewModel->loadFlatSetup(QStringLiteral("quick"));
 
 	//search/restore properties
-	_allowSearch = _currentSetup.allowSearch;
+	_allowSearch = _currentSetup.allowSearch();
 	emit allowSearchChanged(_allowSearch);
-	_allowRestore = _currentSetup.allowRestore;
+	_allowRestore = _currentSetup.allowRestore();
 	emit allowRestoreChanged(_allowRestore);
 
-	if(_currentSetup.categories.size() == 1 &&
-	   _currentSetup.categories.first().sections.size() == 1)
-		loadSection(_currentSetup.categories.first().sections.first());
+	if(_currentSetup.categoryCount() == 1 &&
+	   _currentSetup.sectionCount() == 1)
+		loadSection(0);
 	else {
 		_sectionModel->setup(_currentSetup);
 		emit presentOverview(_sectionFilterModel, _sectionModel->hasSections());
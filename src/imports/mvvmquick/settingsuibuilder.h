@@ -30,7 +30,7 @@ public:
 	QString filterText() const;
 
 public Q_SLOTS:
-	void loadSection(const QtMvvm::SettingsElements::Section &section);
+	void loadSection(int section);
 	void showDialog(const QString &key, const QString &title, const QString &type, const QVariant &defaultValue, const QVariantMap &properties);
 
 	void restoreDefaults();
@@ -65,7 +65,7 @@ private:
 	MultiFilterProxyModel *_entryFilterModel;
 	SettingsEntryModel *_entryModel;
 
-	SettingsElements::Setup _currentSetup;
+	SettingsElements::FlatSetup _currentSetup;
 };
 
 }
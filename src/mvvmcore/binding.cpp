@@ -1,6 +1,7 @@
 #include "binding.h"
 #include "binding_p.h"
 #include "qtmvvm_logging_p.h"
+#include "stalldetector.h"
 using namespace QtMvvm;
 
 Binding QtMvvm::bind(QObject *viewModel, const char *viewModelProperty, QObject *view, const char *viewProperty, Binding::BindingDirection type, const char *viewModelChangeSignal, const char *viewChangeSignal)
@@ -146,11 +147,13 @@ BindingPrivate::BindingPrivate(QObject *viewModel, QMetaProperty viewModelProper
 
 void BindingPrivate::viewModelTrigger()
 {
+	StallDetector::Scope stallScope{StallDetector::BindingUpdate, viewProperty.name()};
 	viewProperty.write(view, viewModelProperty.read(viewModel));
 }
 
 void BindingPrivate::viewTrigger()
 {
+	StallDetector::Scope stallScope{StallDetector::BindingUpdate, viewModelProperty.name()};
 	viewModelProperty.write(viewModel, viewProperty.read(view));
 }
 
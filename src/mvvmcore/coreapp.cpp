@@ -3,6 +3,9 @@
 #include "qtmvvm_logging_p.h"
 #include "serviceregistry_p.h"
 #include "settingssetup.h"
+#include "flightrecorder.h"
+#include "stalldetector.h"
+#include "viewmodel_p.h"
 
 #include <QtCore/QCommandLineParser>
 #include <QtCore/QRegularExpression>
@@ -91,12 +94,91 @@ void CoreApp::show(const QMetaObject *viewModelMetaObject, const QVariantHash &p
 MessageResult *CoreApp::showDialog(const MessageConfig &config)
 {
 	auto result = new MessageResult();
-	QMetaObject::invokeMethod(CoreAppPrivate::dInstance().data(), "showDialog", Qt::QueuedConnection,
-							  Q_ARG(QtMvvm::MessageConfig, config),
-							  Q_ARG(QtMvvm::MessageResult*, result));
+	CoreAppPrivate::dInstance()->enqueueDialog(config, result);
 	return result;
 }
 
+CoreApp::DialogDeduplicationKeys CoreApp::dialogDeduplication()
+{
+	auto dPtr = CoreAppPrivate::dInstance().data();
+	QMutexLocker lock(&dPtr->dialogMutex);
+	return dPtr->dialogDeduplication;
+}
+
+void CoreApp::setDialogDeduplication(DialogDeduplicationKeys keys)
+{
+	auto dPtr = CoreAppPrivate::dInstance().data();
+	QMutexLocker lock(&dPtr->dialogMutex);
+	dPtr->dialogDeduplication = keys;
+}
+
+int CoreApp::maxConcurrentDialogs()
+{
+	auto dPtr = CoreAppPrivate::dInstance().data();
+	QMutexLocker lock(&dPtr->dialogMutex);
+	return dPtr->maxConcurrentDialogs;
+}
+
+void CoreApp::setMaxConcurrentDialogs(int count)
+{
+	auto dPtr = CoreAppPrivate::dInstance().data();
+	QMutexLocker lock(&dPtr->dialogMutex);
+	dPtr->maxConcurrentDialogs = qMax(count, 0);
+	if(!dPtr->dialogQueue.isEmpty())
+		dPtr->scheduleDialogQueue();
+}
+
+int CoreApp::dialogRateLimit()
+{
+	auto dPtr = CoreAppPrivate::dInstance().data();
+	QMutexLocker lock(&dPtr->dialogMutex);
+	return dPtr->dialogRateLimit;
+}
+
+void CoreApp::setDialogRateLimit(int msecs)
+{
+	auto dPtr = CoreAppPrivate::dInstance().data();
+	QMutexLocker lock(&dPtr->dialogMutex);
+	dPtr->dialogRateLimit = qMax(msecs, 0);
+	if(!dPtr->dialogQueue.isEmpty())
+		dPtr->scheduleDialogQueue();
+}
+
+void CoreApp::showNotification(const MessageConfig &config)
+{
+	CoreAppPrivate::dInstance()->enqueueNotification(config);
+}
+
+int CoreApp::notificationBufferSize()
+{
+	auto dPtr = CoreAppPrivate::dInstance().data();
+	QMutexLocker lock(&dPtr->notificationMutex);
+	return dPtr->notificationQueue.capacity();
+}
+
+void CoreApp::setNotificationBufferSize(int size)
+{
+	auto dPtr = CoreAppPrivate::dInstance().data();
+	QMutexLocker lock(&dPtr->notificationMutex);
+	dPtr->notificationQueue.setCapacity(qMax(size, 1));
+}
+
+int CoreApp::notificationRateLimit()
+{
+	auto dPtr = CoreAppPrivate::dInstance().data();
+	QMutexLocker lock(&dPtr->notificationMutex);
+	return dPtr->notificationRateLimit;
+}
+
+void CoreApp::setNotificationRateLimit(int msecs)
+{
+	auto dPtr = CoreAppPrivate::dInstance().data();
+	QMutexLocker lock(&dPtr->notificationMutex);
+	dPtr->notificationRateLimit = qMax(msecs, 0);
+	if(!dPtr->notificationQueue.isEmpty())
+		dPtr->scheduleNotificationQueue();
+}
+
 QVariant CoreApp::safeCastInputType(const QByteArray &type, const QVariant &value)
 {
 	// get the target type, either explicitly or from the name
@@ -206,6 +288,7 @@ void CoreApp::showImp(const QMetaObject *metaObject, const QVariantHash &params)
 
 void CoreApp::showImp(const QMetaObject *metaObject, const QVariantHash &params, QPointer<ViewModel> parentViewModel)
 {
+	FlightRecorder::record(FlightRecorder::ShowRequested, metaObject);
 	QMetaObject::invokeMethod(CoreAppPrivate::dInstance().data(), "showViewModel", Qt::QueuedConnection,
 							  Q_ARG(const QMetaObject*, metaObject),
 							  Q_ARG(QVariantHash, params),
@@ -232,8 +315,18 @@ CoreAppPrivate::CoreAppPrivate() :
 		{"selection", QMetaType::QVariant},
 		{"list", QMetaType::QVariant},
 		{"radiolist", QMetaType::QVariant},
-	}
-{}
+	},
+	dialogRateTimer{new QTimer{this}},
+	notificationQueue{32},
+	notificationRateTimer{new QTimer{this}}
+{
+	dialogRateTimer->setSingleShot(true);
+	connect(dialogRateTimer, &QTimer::timeout,
+			this, &CoreAppPrivate::processDialogQueue);
+	notificationRateTimer->setSingleShot(true);
+	connect(notificationRateTimer, &QTimer::timeout,
+			this, &CoreAppPrivate::processNotificationQueue);
+}
 
 QScopedPointer<CoreAppPrivate> &CoreAppPrivate::dInstance()
 {
@@ -250,6 +343,7 @@ void CoreAppPrivate::showDialog(const MessageConfig &config, MessageResult *resu
 	if(presenter) {
 		try {
 			presenter->showDialog(config, result);
+			FlightRecorder::recordDialog(config.type());
 			logDebug() << "Successfully presented dialog of type" << config.type();
 		} catch(QTMVVM_EXCEPTION_BASE &e) {
 			logCritical() << "Failed to show dialog for type"
@@ -266,6 +360,204 @@ void CoreAppPrivate::showDialog(const MessageConfig &config, MessageResult *resu
 	}
 }
 
+void CoreAppPrivate::enqueueDialog(const MessageConfig &config, MessageResult *result)
+{
+	QMutexLocker lock(&dialogMutex);
+	if(dialogDeduplication != CoreApp::DeduplicateNone) {
+		for(auto &request : dialogQueue) {
+			if(isDuplicate(request.config, config)) {
+				logDebug() << "Merging dialog of type" << config.type()
+						   << "with an identical pending dialog";
+				request.results.append(result);
+				return;
+			}
+		}
+	}
+
+	dialogQueue.append({config, {result}});
+	scheduleDialogQueue();
+}
+
+void CoreAppPrivate::processDialogQueue()
+{
+	QMutexLocker lock(&dialogMutex);
+	dialogQueueScheduled = false;
+	while(!dialogQueue.isEmpty()) {
+		// continued by finishDialog once a dialog was closed
+		if(maxConcurrentDialogs > 0 && activeDialogs.size() >= maxConcurrentDialogs)
+			return;
+		// continued by the rate timer
+		if(dialogRateLimit > 0 && lastDialogTimer.isValid()) {
+			auto remaining = dialogRateLimit - lastDialogTimer.elapsed();
+			if(remaining > 0) {
+				dialogRateTimer->start(static_cast<int>(remaining));
+				return;
+			}
+		}
+
+		auto request = dialogQueue.takeFirst();
+		lock.unlock(); // presenters may show dialogs themselves
+		presentDialog(request);
+		lock.relock();
+	}
+}
+
+bool CoreAppPrivate::isDuplicate(const MessageConfig &lhs, const MessageConfig &rhs) const
+{
+	// progress dialogs are bound to their ProgressControl and can never be merged
+	if(lhs.type() == MessageConfig::TypeProgressDialog ||
+	   rhs.type() == MessageConfig::TypeProgressDialog)
+		return false;
+
+	if(dialogDeduplication.testFlag(CoreApp::DeduplicateType) &&
+	   lhs.type() != rhs.type())
+		return false;
+	if(dialogDeduplication.testFlag(CoreApp::DeduplicateSubType) &&
+	   lhs.subType() != rhs.subType())
+		return false;
+	if(dialogDeduplication.testFlag(CoreApp::DeduplicateTitle) &&
+	   lhs.title() != rhs.title())
+		return false;
+	if(dialogDeduplication.testFlag(CoreApp::DeduplicateText) &&
+	   lhs.text() != rhs.text())
+		return false;
+	return true;
+}
+
+void CoreAppPrivate::scheduleDialogQueue()
+{
+	// must be called with the dialogMutex locked
+	if(dialogQueueScheduled)
+		return;
+	dialogQueueScheduled = true;
+	QMetaObject::invokeMethod(this, "processDialogQueue", Qt::QueuedConnection);
+}
+
+void CoreAppPrivate::presentDialog(const DialogRequest &request)
+{
+	// the first alive result is passed to the presenter, all others mirror it
+	MessageResult *result = nullptr;
+	QList<QPointer<MessageResult>> merged;
+	for(const auto &res : request.results) {
+		if(!res)
+			continue;
+		if(result)
+			merged.append(res);
+		else
+			result = res;
+	}
+	if(!result) {
+		logDebug() << "Skipping dialog of type" << request.config.type()
+				   << "- all results have been destroyed";
+		return;
+	}
+
+	activeDialogs.insert(result);
+	if(dialogRateLimit > 0)
+		lastDialogTimer.start();
+	connect(result, &MessageResult::dialogDone,
+			this, [this, result, merged](MessageConfig::StandardButton button) {
+		auto res = result->result();
+		for(const auto &mergedResult : merged) {
+			if(mergedResult)
+				mergedResult->complete(button, res);
+		}
+		finishDialog(result);
+	});
+	connect(result, &MessageResult::destroyed,
+			this, [this, result, merged]() {
+		if(finishDialog(result)) {
+			for(const auto &mergedResult : merged) {
+				if(mergedResult)
+					mergedResult->complete(MessageConfig::NoButton);
+			}
+		}
+	});
+
+	showDialog(request.config, result);
+}
+
+bool CoreAppPrivate::finishDialog(MessageResult *result)
+{
+	if(!activeDialogs.remove(result))
+		return false;
+
+	QMutexLocker lock(&dialogMutex);
+	if(!dialogQueue.isEmpty())
+		scheduleDialogQueue();
+	return true;
+}
+
+void CoreAppPrivate::enqueueNotification(const MessageConfig &config)
+{
+	QMutexLocker lock(&notificationMutex);
+	// search from the back, as repeated notifications are usually sent in bursts
+	for(auto i = notificationQueue.lastIndex(); i >= notificationQueue.firstIndex(); i--) {
+		auto &entry = notificationQueue[i];
+		if(isSameNotification(entry.config, config)) {
+			entry.count++;
+			return;
+		}
+	}
+
+	if(notificationQueue.isFull()) {
+		logDebug() << "Notification buffer is full - dropping the oldest pending notification of type"
+				   << notificationQueue.first().config.subType();
+	}
+	notificationQueue.append({config, 1});
+	if(!notificationQueue.areIndexesValid())
+		notificationQueue.normalizeIndexes();
+	scheduleNotificationQueue();
+}
+
+void CoreAppPrivate::processNotificationQueue()
+{
+	QMutexLocker lock(&notificationMutex);
+	notificationQueueScheduled = false;
+	while(!notificationQueue.isEmpty()) {
+		// continued by the rate timer
+		if(notificationRateLimit > 0 && lastNotificationTimer.isValid()) {
+			auto remaining = notificationRateLimit - lastNotificationTimer.elapsed();
+			if(remaining > 0) {
+				notificationRateTimer->start(static_cast<int>(remaining));
+				return;
+			}
+		}
+
+		auto entry = notificationQueue.takeFirst();
+		if(notificationRateLimit > 0)
+			lastNotificationTimer.start();
+		lock.unlock();
+		presentNotification(entry);
+		lock.relock();
+	}
+}
+
+bool CoreAppPrivate::isSameNotification(const MessageConfig &lhs, const MessageConfig &rhs) const
+{
+	return lhs.subType() == rhs.subType() &&
+			lhs.title() == rhs.title() &&
+			lhs.text() == rhs.text();
+}
+
+void CoreAppPrivate::scheduleNotificationQueue()
+{
+	// must be called with the notificationMutex locked
+	if(notificationQueueScheduled)
+		return;
+	notificationQueueScheduled = true;
+	QMetaObject::invokeMethod(this, "processNotificationQueue", Qt::QueuedConnection);
+}
+
+void CoreAppPrivate::presentNotification(const NotificationEntry &entry)
+{
+	auto config = entry.config;
+	if(entry.count > 1)
+		config.setViewProperty(QStringLiteral("repeatCount"), entry.count);
+	// notifications have no result, presenters complete it right away
+	showDialog(config, new MessageResult{});
+}
+
 bool CoreAppPrivate::isSingleton(const QMetaObject *metaObject) const
 {
 	auto sInfoIndex = metaObject->indexOfClassInfo("qtmvvm_singleton");
@@ -312,15 +604,19 @@ const QMetaObject *CoreAppPrivate::getContainer(const QMetaObject *metaObject) c
 		return nullptr;
 }
 
-QPointer<ViewModel> CoreAppPrivate::showViewModelWithReturn(const QMetaObject *metaObject, const QVariantHash &params, QPointer<ViewModel> parent, quint32 requestCode)
+QPointer<ViewModel> CoreAppPrivate::showViewModelWithReturn(const QMetaObject *metaObject, const QVariantHash &params, QPointer<ViewModel> parent, quint32 requestCode, const std::function<void(ViewModel*)> &typedInit)
 {
 	if(presenter) {
+		StallDetector::Scope stallScope{StallDetector::ShowViewModel, metaObject->className()};
 		// first: handle a singleton
 		auto isSingle = isSingleton(metaObject);
 		if(isSingle) {
 			auto viewModel = singleInstances.value(metaObject);
 			if(viewModel) {
 				logDebug() << "Found existing single instance for" << metaObject->className();
+				FlightRecorder::record(FlightRecorder::SingleInstanceInvoked, metaObject);
+				if(typedInit)
+					typedInit(viewModel);
 				emit viewModel->instanceInvoked(params, ViewModel::QPrivateSignal{});
 				return viewModel;
 			}
@@ -339,6 +635,7 @@ QPointer<ViewModel> CoreAppPrivate::showViewModelWithReturn(const QMetaObject *m
 					throw PresenterException{"Failed to present parent container"};
 			}
 		} catch(PresenterException &e) {
+			FlightRecorder::record(FlightRecorder::PresentFailed, metaObject);
 			logCritical() << "Failed to present viewmodel of type"
 						  << metaObject->className()
 						  << "with error:"
@@ -352,23 +649,44 @@ QPointer<ViewModel> CoreAppPrivate::showViewModelWithReturn(const QMetaObject *m
 			vm = qobject_cast<ViewModel*>(obj);
 			if(!vm)
 				throw ServiceConstructionException("Invalid types - not at QtMvvm::ViewModel");
+			FlightRecorder::record(FlightRecorder::ViewModelConstructed, metaObject);
+			// typed parameters are delivered before the presenter calls onInit
+			if(typedInit)
+				typedInit(vm);
 			presenter->present(vm, params, parent);
 			if(requestCode != 0) {
-				QObject::connect(vm, &ViewModel::resultReady, parent, [vm, requestCode, parent](const QVariant &r){
-					vm->disconnect(parent);
-					parent->onResult(requestCode, r);
-				});
-				QObject::connect(vm, &ViewModel::destroyed, parent, [vm, requestCode, parent](){
-					parent->onResult(requestCode, QVariant());
-				});
+				// the request is queued, so the requesting viewmodel may already be gone
+				if(parent) {
+					parent->d->pendingResults.ref();
+					QObject::connect(vm, &ViewModel::resultReady, parent, [vm, requestCode, parent](const QVariant &r){
+						if(!parent)
+							return;
+						vm->disconnect(parent);
+						parent->d->pendingResults.deref();
+						FlightRecorder::record(FlightRecorder::ResultDelivered, vm->metaObject(), requestCode);
+						parent->onResult(requestCode, r);
+					});
+					QObject::connect(vm, &ViewModel::destroyed, parent, [requestCode, parent](){
+						if(!parent)
+							return;
+						parent->d->pendingResults.deref();
+						parent->onResult(requestCode, QVariant());
+					});
+				} else {
+					logWarning() << "The viewmodel that requested a result from"
+								 << metaObject->className()
+								 << "was destroyed before it was presented";
+				}
 			}
 			logDebug() << "Successfully presented" << metaObject->className();
+			FlightRecorder::record(FlightRecorder::Presented, metaObject);
 
 			// if singleton -> store it
 			if(isSingle)
 				singleInstances.insert(metaObject, vm);
 			return vm;
 		} catch(QTMVVM_EXCEPTION_BASE &e) {
+			FlightRecorder::record(FlightRecorder::PresentFailed, metaObject);
 			logCritical() << "Failed to present viewmodel of type"
 						  << metaObject->className()
 						  << "with error:"
@@ -377,6 +695,7 @@ QPointer<ViewModel> CoreAppPrivate::showViewModelWithReturn(const QMetaObject *m
 				vm->deleteLater();
 		}
 	} else {
+		FlightRecorder::record(FlightRecorder::PresentFailed, metaObject);
 		logCritical() << "Failed to present viewmodel of type"
 					  << metaObject->className()
 					  << "- no presenter was set";
@@ -22,6 +22,18 @@ class Q_MVVMCORE_EXPORT CoreApp : public QObject
 	Q_OBJECT
 
 public:
+	//! The fields of a MessageConfig that are compared to merge identical pending dialogs
+	enum DialogDeduplicationKey {
+		DeduplicateNone = 0x00, //!< Never merge pending dialogs
+		DeduplicateType = 0x01, //!< Compare the MessageConfig::type
+		DeduplicateSubType = 0x02, //!< Compare the MessageConfig::subType
+		DeduplicateTitle = 0x04, //!< Compare the MessageConfig::title
+		DeduplicateText = 0x08, //!< Compare the MessageConfig::text
+		DeduplicateAll = (DeduplicateType | DeduplicateSubType | DeduplicateTitle | DeduplicateText) //!< Compare all of the above
+	};
+	Q_DECLARE_FLAGS(DialogDeduplicationKeys, DialogDeduplicationKey)
+	Q_FLAG(DialogDeduplicationKeys)
+
 	//! Default Constructor
 	explicit CoreApp(QObject *parent = nullptr);
 	~CoreApp() override;
@@ -37,6 +49,9 @@ public:
 	//! Show a new ViewModel by its type
 	template <typename TViewModel>
 	static inline void show(const QVariantHash &params = {}, QPointer<ViewModel> parentViewModel = nullptr);
+	//! Show a new ViewModel by its type and move the typed parameters to its onInitParams() method
+	template <typename TViewModel, typename TParams, typename = std::enable_if_t<!std::is_same<std::decay_t<TParams>, QVariantHash>::value>>
+	static inline void show(TParams &&params, QPointer<ViewModel> parentViewModel = nullptr);
 	//! @copydoc CoreApp::show(const char *, const QVariantHash &, QPointer<ViewModel>);
 	static void show(const char *viewModelName, const QVariantHash &params = {}); //MAJOR merge methods
 	//! Show a new ViewModel by its name
@@ -49,6 +64,30 @@ public:
 	//! Show a basic dialog
 	static MessageResult *showDialog(const MessageConfig &config);
 
+	//! Returns the keys used to merge identical pending dialogs
+	static DialogDeduplicationKeys dialogDeduplication();
+	//! Sets the keys used to merge identical pending dialogs
+	static void setDialogDeduplication(DialogDeduplicationKeys keys);
+	//! Returns the maximum number of dialogs shown at the same time. 0 means unlimited
+	static int maxConcurrentDialogs();
+	//! Sets the maximum number of dialogs shown at the same time. 0 means unlimited
+	static void setMaxConcurrentDialogs(int count);
+	//! Returns the minimum interval between showing two dialogs in milliseconds. 0 means disabled
+	static int dialogRateLimit();
+	//! Sets the minimum interval between showing two dialogs in milliseconds. 0 means disabled
+	static void setDialogRateLimit(int msecs);
+
+	//! Show a non-modal notification. Identical pending notifications are merged
+	static void showNotification(const MessageConfig &config);
+	//! Returns the maximum number of pending notifications. The oldest ones are dropped once exceeded
+	static int notificationBufferSize();
+	//! Sets the maximum number of pending notifications. The oldest ones are dropped once exceeded
+	static void setNotificationBufferSize(int size);
+	//! Returns the minimum interval between showing two notifications in milliseconds. 0 means disabled
+	static int notificationRateLimit();
+	//! Sets the minimum interval between showing two notifications in milliseconds. 0 means disabled
+	static void setNotificationRateLimit(int msecs);
+
 	//! Safely casts a value of the given edit type to the corresponding variant type
 	static QVariant safeCastInputType(const QByteArray &type, const QVariant &value);
 	//! Register a type to be used as variant type for the given edit type
@@ -94,6 +133,15 @@ inline void CoreApp::show(const QVariantHash &params, QPointer<ViewModel> parent
 	showImp(&TViewModel::staticMetaObject, params, std::move(parentViewModel));
 }
 
+template<typename TViewModel, typename TParams, typename>
+inline void CoreApp::show(TParams &&params, QPointer<ViewModel> parentViewModel)
+{
+	static_assert(std::is_base_of<ViewModel, TViewModel>::value, "TViewModel must extend QtMvvm::ViewModel");
+	ViewModel::showImp(&TViewModel::staticMetaObject,
+					   ViewModel::packTypedInit<TViewModel>(std::forward<TParams>(params)),
+					   std::move(parentViewModel));
+}
+
 template<typename T>
 void CoreApp::registerInputTypeMapping(const QByteArray &type)
 {
@@ -102,6 +150,8 @@ void CoreApp::registerInputTypeMapping(const QByteArray &type)
 
 }
 
+Q_DECLARE_OPERATORS_FOR_FLAGS(QtMvvm::CoreApp::DialogDeduplicationKeys)
+
 //! Registers you custom CoreApp class as CoreApp to be used
 #define QTMVVM_REGISTER_CORE_APP(T) namespace {\
 	void __setup_ ## T ## _hook() { \
@@ -2,6 +2,13 @@
 #define QTMVVM_COREAPP_P_H
 
 #include <QtCore/QPointer>
+#include <QtCore/QMutex>
+#include <QtCore/QSet>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QTimer>
+#include <QtCore/QContiguousCache>
+
+#include <functional>
 
 #include "qtmvvmcore_global.h"
 #include "coreapp.h"
@@ -12,12 +19,26 @@ class Q_MVVMCORE_EXPORT CoreAppPrivate : public QObject
 {
 	Q_OBJECT
 	friend class QtMvvm::CoreApp;
+	friend class QtMvvm::ViewModel;
 
 public:
+	struct DialogRequest {
+		MessageConfig config;
+		QList<QPointer<MessageResult>> results;
+	};
+
+	struct NotificationEntry {
+		MessageConfig config;
+		int count = 1;
+	};
+
 	CoreAppPrivate();
 
 	static QScopedPointer<CoreAppPrivate> &dInstance();
 
+	void enqueueDialog(const MessageConfig &config, MessageResult *result);
+	void enqueueNotification(const MessageConfig &config);
+
 public Q_SLOTS:
 	void showViewModel(const QMetaObject *metaObject,
 					   const QVariantHash &params,
@@ -25,6 +46,10 @@ public Q_SLOTS:
 					   quint32 requestCode);
 	void showDialog(const QtMvvm::MessageConfig &config, QtMvvm::MessageResult *result);
 
+private Q_SLOTS:
+	void processDialogQueue();
+	void processNotificationQueue();
+
 private:
 	static bool bootEnabled;
 	static QPointer<CoreApp> instance;
@@ -33,13 +58,40 @@ private:
 	QHash<QByteArray, int> inputTypeMapping;
 	QHash<const QMetaObject*, QPointer<ViewModel>> singleInstances;
 
+	QMutex dialogMutex;
+	QList<DialogRequest> dialogQueue;
+	bool dialogQueueScheduled = false;
+	CoreApp::DialogDeduplicationKeys dialogDeduplication = CoreApp::DeduplicateNone;
+	int maxConcurrentDialogs = 0;
+	int dialogRateLimit = 0;
+	QSet<MessageResult*> activeDialogs;
+	QElapsedTimer lastDialogTimer;
+	QTimer *dialogRateTimer;
+
+	QMutex notificationMutex;
+	QContiguousCache<NotificationEntry> notificationQueue;
+	bool notificationQueueScheduled = false;
+	int notificationRateLimit = 250;
+	QElapsedTimer lastNotificationTimer;
+	QTimer *notificationRateTimer;
+
+	bool isDuplicate(const MessageConfig &lhs, const MessageConfig &rhs) const;
+	void scheduleDialogQueue();
+	void presentDialog(const DialogRequest &request);
+	bool finishDialog(MessageResult *result);
+
+	bool isSameNotification(const MessageConfig &lhs, const MessageConfig &rhs) const;
+	void scheduleNotificationQueue();
+	void presentNotification(const NotificationEntry &entry);
+
 	bool isSingleton(const QMetaObject *metaObject) const;
 	const QMetaObject * getContainer(const QMetaObject *metaObject) const;
 
 	QPointer<ViewModel> showViewModelWithReturn(const QMetaObject *metaObject,
 												const QVariantHash &params,
 												QPointer<ViewModel> parent,
-												quint32 requestCode);
+												quint32 requestCode,
+												const std::function<void(ViewModel*)> &typedInit = {});
 };
 
 }
@@ -0,0 +1,225 @@
+#include "flightrecorder.h"
+#include "message.h"
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+#include <QtCore/QMetaObject>
+#include <QtCore/QMutex>
+#include <atomic>
+#include <memory>
+using namespace QtMvvm;
+
+namespace {
+
+struct Slot {
+	// 0 while empty or beeing written, otherwise the event index + 1
+	std::atomic<quint64> sequence{0};
+	FlightRecorder::Event event;
+};
+
+struct RecorderData {
+	RecorderData();
+
+	QElapsedTimer timer;
+	std::atomic<bool> enabled{true};
+	std::atomic<quint64> head{0};
+	quint64 mask = 0;
+	std::unique_ptr<Slot[]> slots;
+
+	QMutex crashMutex;
+	QString crashDumpPath;
+	QtMessageHandler previousHandler = nullptr;
+
+	void resize(int capacity);
+};
+
+Q_GLOBAL_STATIC(RecorderData, recorder)
+
+void crashMessageHandler(QtMsgType type, const QMessageLogContext &context, const QString &message)
+{
+	auto data = recorder();
+	if(!data)
+		return;
+	if(type == QtFatalMsg) {
+		QMutexLocker lock{&data->crashMutex};
+		if(!data->crashDumpPath.isEmpty())
+			FlightRecorder::dump(data->crashDumpPath);
+	}
+	if(data->previousHandler)
+		data->previousHandler(type, context, message);
+}
+
+}
+
+bool FlightRecorder::isEnabled()
+{
+	auto data = recorder();
+	return data && data->enabled.load(std::memory_order_relaxed);
+}
+
+void FlightRecorder::setEnabled(bool enabled)
+{
+	recorder()->enabled.store(enabled, std::memory_order_relaxed);
+}
+
+int FlightRecorder::capacity()
+{
+	return static_cast<int>(recorder()->mask + 1);
+}
+
+void FlightRecorder::setCapacity(int capacity)
+{
+	auto data = recorder();
+	auto wasEnabled = data->enabled.exchange(false);
+	data->resize(capacity);
+	data->enabled.store(wasEnabled);
+}
+
+void FlightRecorder::record(EventType type, const QMetaObject *metaObject, quint32 value) noexcept
+{
+	auto data = recorder();
+	if(!data || !data->enabled.load(std::memory_order_relaxed))
+		return;
+
+	const auto index = data->head.fetch_add(1, std::memory_order_relaxed);
+	auto &slot = data->slots[index & data->mask];
+	slot.sequence.store(0, std::memory_order_relaxed);
+	std::atomic_thread_fence(std::memory_order_release);
+	slot.event.timestamp = data->timer.nsecsElapsed();
+	slot.event.metaObject = metaObject;
+	slot.event.value = value;
+	slot.event.type = type;
+	slot.sequence.store(index + 1, std::memory_order_release);
+}
+
+void FlightRecorder::recordDialog(const QByteArray &dialogType) noexcept
+{
+	static const QByteArray knownTypes[] = {
+		MessageConfig::TypeMessageBox,
+		MessageConfig::TypeInputDialog,
+		MessageConfig::TypeFileDialog,
+		MessageConfig::TypeColorDialog,
+		MessageConfig::TypeProgressDialog,
+		MessageConfig::TypeNotification
+	};
+	quint32 typeIndex = 0; // 0 for custom types
+	for(quint32 i = 0; i < sizeof(knownTypes) / sizeof(knownTypes[0]); i++) {
+		if(knownTypes[i] == dialogType) {
+			typeIndex = i + 1;
+			break;
+		}
+	}
+	record(DialogShown, nullptr, typeIndex);
+}
+
+QVector<FlightRecorder::Event> FlightRecorder::events()
+{
+	auto data = recorder();
+	QVector<Event> events;
+	if(!data)
+		return events;
+
+	const auto head = data->head.load(std::memory_order_acquire);
+	const auto capacity = data->mask + 1;
+	const auto begin = head > capacity ? head - capacity : 0;
+	events.reserve(static_cast<int>(head - begin));
+	for(auto index = begin; index < head; ++index) {
+		const auto &slot = data->slots[index & data->mask];
+		const auto before = slot.sequence.load(std::memory_order_acquire);
+		auto event = slot.event;
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const auto after = slot.sequence.load(std::memory_order_relaxed);
+		// skip events that are currently written or have already been overwritten
+		if(before == index + 1 && after == before)
+			events.append(event);
+	}
+	return events;
+}
+
+void FlightRecorder::clear()
+{
+	auto data = recorder();
+	data->resize(static_cast<int>(data->mask + 1));
+}
+
+bool FlightRecorder::dump(QIODevice *device)
+{
+	if(!device->isWritable())
+		return false;
+
+	const auto allEvents = events();
+	QTextStream stream{device};
+	stream << "QtMvvm flight recorder: " << allEvents.size() << " events, oldest first\n";
+	for(const auto &event : allEvents) {
+		stream << QString::number(event.timestamp / 1000000.0, 'f', 3).rightJustified(14)
+			   << " ms  " << typeName(event.type);
+		if(event.metaObject)
+			stream << "  " << event.metaObject->className();
+		stream << "  " << event.value << '\n';
+	}
+	stream.flush();
+	return stream.status() == QTextStream::Ok;
+}
+
+bool FlightRecorder::dump(const QString &filePath)
+{
+	QFile file{filePath};
+	if(!file.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Truncate))
+		return false;
+	return dump(&file);
+}
+
+void FlightRecorder::setCrashDumpPath(const QString &filePath)
+{
+	auto data = recorder();
+	QMutexLocker lock{&data->crashMutex};
+	data->crashDumpPath = filePath;
+	if(!filePath.isEmpty() && !data->previousHandler)
+		data->previousHandler = qInstallMessageHandler(crashMessageHandler);
+}
+
+const char *FlightRecorder::typeName(EventType type)
+{
+	switch(type) {
+	case InvalidEvent:
+		return "Invalid";
+	case ShowRequested:
+		return "ShowRequested";
+	case ViewModelConstructed:
+		return "ViewModelConstructed";
+	case SingleInstanceInvoked:
+		return "SingleInstanceInvoked";
+	case ViewCreated:
+		return "ViewCreated";
+	case Presented:
+		return "Presented";
+	case PresentFailed:
+		return "PresentFailed";
+	case DialogShown:
+		return "DialogShown";
+	case DialogDone:
+		return "DialogDone";
+	case ResultDelivered:
+		return "ResultDelivered";
+	default:
+		return type >= UserEvent ? "UserEvent" : "Unknown";
+	}
+}
+
+// ------------- Private Implementation -------------
+
+RecorderData::RecorderData()
+{
+	timer.start();
+	resize(4096);
+}
+
+void RecorderData::resize(int capacity)
+{
+	quint64 size = 1;
+	while(size < static_cast<quint64>(qMax(capacity, 1)))
+		size <<= 1;
+	slots.reset(new Slot[size]);
+	mask = size - 1;
+	head.store(0);
+}
@@ -0,0 +1,88 @@
+#ifndef QTMVVM_FLIGHTRECORDER_H
+#define QTMVVM_FLIGHTRECORDER_H
+
+#include <QtCore/qglobal.h>
+#include <QtCore/qvector.h>
+#include <QtCore/qstring.h>
+
+#include "QtMvvmCore/qtmvvmcore_global.h"
+
+QT_BEGIN_NAMESPACE
+class QIODevice;
+QT_END_NAMESPACE
+
+namespace QtMvvm {
+
+//! A low overhead ring buffer that records navigation and dialog events
+class Q_MVVMCORE_EXPORT FlightRecorder
+{
+	Q_DISABLE_COPY(FlightRecorder)
+
+public:
+	//! The kinds of events that are recorded
+	enum EventType : quint8 {
+		InvalidEvent = 0, //!< Marks an unused or overwritten slot
+		ShowRequested, //!< A viewmodel show was requested. The value is the request code
+		ViewModelConstructed, //!< A viewmodel instance was created by the CoreApp
+		SingleInstanceInvoked, //!< An existing singleton viewmodel was shown again
+		ViewCreated, //!< A view for a viewmodel was created by the presenter
+		Presented, //!< A viewmodel was successfully presented
+		PresentFailed, //!< Presenting a viewmodel failed
+		DialogShown, //!< A dialog was passed to the presenter. The value is the dialog type index
+		DialogDone, //!< A dialog was completed. The value is the pressed button
+		ResultDelivered, //!< A viewmodel result was delivered to its parent. The value is the request code
+
+		UserEvent = 0x80 //!< The first value that can be used for custom events
+	};
+
+	//! A single recorded event
+	struct Event {
+		//! The nanoseconds since the recorder was started
+		qint64 timestamp = 0;
+		//! The type of the viewmodel or view the event is about. Can be null
+		const QMetaObject *metaObject = nullptr;
+		//! An event specific value
+		quint32 value = 0;
+		//! The type of the event
+		EventType type = InvalidEvent;
+	};
+
+	//! Returns true if events are recorded. Enabled by default
+	static bool isEnabled();
+	//! Enables or disables recording
+	static void setEnabled(bool enabled);
+	//! Returns the number of events kept before the oldest are overwritten
+	static int capacity();
+	//! Sets the capacity, rounded up to a power of two. Clears all events
+	static void setCapacity(int capacity);
+
+	//! Records an event. Does neither allocate nor format anything
+	static void record(EventType type, const QMetaObject *metaObject = nullptr, quint32 value = 0) noexcept;
+	//! Records a DialogShown event for the given dialog type
+	static void recordDialog(const QByteArray &dialogType) noexcept;
+
+	//! Returns all events currently in the buffer, oldest first
+	static QVector<Event> events();
+	//! Removes all events from the buffer
+	static void clear();
+
+	//! Writes the events as human readable text to the device
+	static bool dump(QIODevice *device);
+	//! Writes the events as human readable text to the given file
+	static bool dump(const QString &filePath);
+	//! Dumps the events to the given file when a fatal message is logged. Pass an empty path to disable
+	static void setCrashDumpPath(const QString &filePath);
+
+	//! Returns a readable name for an event type
+	static const char *typeName(EventType type);
+
+private:
+	FlightRecorder() = delete;
+};
+
+}
+
+Q_DECLARE_TYPEINFO(QtMvvm::FlightRecorder::Event, Q_MOVABLE_TYPE);
+
+//! @file flightrecorder.h The FlightRecorder class header
+#endif // QTMVVM_FLIGHTRECORDER_H
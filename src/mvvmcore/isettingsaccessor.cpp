@@ -2,6 +2,18 @@
 #include "qsettingsaccessor.h"
 using namespace QtMvvm;
 
+namespace {
+
+template <typename T>
+inline T loadTyped(const ISettingsAccessor *accessor, const QString &key, const T &defaultValue)
+{
+	// only box the value, not the default
+	const auto value = accessor->load(key);
+	return value.isValid() ? value.value<T>() : defaultValue;
+}
+
+}
+
 int ISettingsAccessor::_DefaultAccessorType = qMetaTypeId<QSettingsAccessor*>();
 
 void ISettingsAccessor::setDefaultAccessor(int typeId)
@@ -25,3 +37,63 @@ ISettingsAccessor *ISettingsAccessor::createDefaultAccessor(QObject *parent)
 ISettingsAccessor::ISettingsAccessor(QObject *parent) :
 	QObject{parent}
 {}
+
+bool ISettingsAccessor::loadBool(const QString &key, bool defaultValue) const
+{
+	return loadTyped(this, key, defaultValue);
+}
+
+int ISettingsAccessor::loadInt(const QString &key, int defaultValue) const
+{
+	return loadTyped(this, key, defaultValue);
+}
+
+qint64 ISettingsAccessor::loadInt64(const QString &key, qint64 defaultValue) const
+{
+	return loadTyped(this, key, defaultValue);
+}
+
+double ISettingsAccessor::loadDouble(const QString &key, double defaultValue) const
+{
+	return loadTyped(this, key, defaultValue);
+}
+
+QString ISettingsAccessor::loadString(const QString &key, const QString &defaultValue) const
+{
+	return loadTyped(this, key, defaultValue);
+}
+
+QByteArray ISettingsAccessor::loadByteArray(const QString &key, const QByteArray &defaultValue) const
+{
+	return loadTyped(this, key, defaultValue);
+}
+
+void ISettingsAccessor::saveBool(const QString &key, bool value)
+{
+	save(key, value);
+}
+
+void ISettingsAccessor::saveInt(const QString &key, int value)
+{
+	save(key, value);
+}
+
+void ISettingsAccessor::saveInt64(const QString &key, qint64 value)
+{
+	save(key, value);
+}
+
+void ISettingsAccessor::saveDouble(const QString &key, double value)
+{
+	save(key, value);
+}
+
+void ISettingsAccessor::saveString(const QString &key, const QString &value)
+{
+	save(key, value);
+}
+
+void ISettingsAccessor::saveByteArray(const QString &key, const QByteArray &value)
+{
+	save(key, value);
+}
@@ -5,6 +5,7 @@
 
 #include <QtCore/qobject.h>
 #include <QtCore/qstring.h>
+#include <QtCore/qbytearray.h>
 #include <QtCore/qvariant.h>
 
 #include "QtMvvmCore/qtmvvmcore_global.h"
@@ -39,6 +40,32 @@ public:
 	//! Removes the key and all its subkeys from the settings
 	virtual void remove(const QString &key) = 0;
 
+	//! Loads the bool value for the given key from the settings
+	virtual bool loadBool(const QString &key, bool defaultValue = false) const;
+	//! Loads the int value for the given key from the settings
+	virtual int loadInt(const QString &key, int defaultValue = 0) const;
+	//! Loads the qint64 value for the given key from the settings
+	virtual qint64 loadInt64(const QString &key, qint64 defaultValue = 0) const;
+	//! Loads the double value for the given key from the settings
+	virtual double loadDouble(const QString &key, double defaultValue = 0.0) const;
+	//! Loads the string value for the given key from the settings
+	virtual QString loadString(const QString &key, const QString &defaultValue = {}) const;
+	//! Loads the byte array value for the given key from the settings
+	virtual QByteArray loadByteArray(const QString &key, const QByteArray &defaultValue = {}) const;
+
+	//! Stores the given bool value under the given key in the settings
+	virtual void saveBool(const QString &key, bool value);
+	//! Stores the given int value under the given key in the settings
+	virtual void saveInt(const QString &key, int value);
+	//! Stores the given qint64 value under the given key in the settings
+	virtual void saveInt64(const QString &key, qint64 value);
+	//! Stores the given double value under the given key in the settings
+	virtual void saveDouble(const QString &key, double value);
+	//! Stores the given string value under the given key in the settings
+	virtual void saveString(const QString &key, const QString &value);
+	//! Stores the given byte array value under the given key in the settings
+	virtual void saveByteArray(const QString &key, const QByteArray &value);
+
 public Q_SLOTS:
 	//! Synchronizes the settings to the disk or whatever is needed to permanently store them
 	virtual void sync() = 0;
@@ -56,7 +83,7 @@ private:
 template<typename T>
 void ISettingsAccessor::setDefaultAccessor()
 {
-	static_assert(std::is_base_of<T, ISettingsAccessor>::value, "T must implement the QtMvvm::ISettingsAccessor interface");
+	static_assert(std::is_base_of<ISettingsAccessor, T>::value, "T must implement the QtMvvm::ISettingsAccessor interface");
 	setDefaultAccessor(qMetaTypeId<T*>());
 }
 
@@ -0,0 +1,60 @@
+#include "listelements_p.h"
+using namespace QtMvvm;
+
+ListElements::ListElements(const QVariantList &listElements) :
+	_listElements{listElements}
+{
+	// a single pass over the elements, that is the only time they are converted
+	_elements.reserve(listElements.size());
+	_valueIndexes.reserve(listElements.size());
+	for(const auto &item : listElements) {
+		Element element;
+		if(item.type() == QVariant::Map) {
+			auto iData = item.toMap();
+			element.name = iData.value(QStringLiteral("name")).toString();
+			element.value = iData.value(QStringLiteral("value"));
+		} else {
+			element.name = item.toString();
+			element.value = item;
+		}
+		// only the first element with a value is found, just like QComboBox::findData
+		auto key = element.value.toString();
+		auto it = _valueIndexes.constFind(key);
+		if(it == _valueIndexes.constEnd())
+			_valueIndexes.insert(key, _elements.size());
+		else if(_elements[it.value()].value != element.value)
+			_ambiguous = true;
+		_elements.append(element);
+	}
+}
+
+QVariantList ListElements::listElements() const
+{
+	return _listElements;
+}
+
+int ListElements::size() const
+{
+	return _elements.size();
+}
+
+const ListElements::Element &ListElements::at(int index) const
+{
+	return _elements[index];
+}
+
+int ListElements::indexOf(const QVariant &value) const
+{
+	auto index = _valueIndexes.value(value.toString(), -1);
+	if(index != -1 && _elements[index].value == value)
+		return index;
+	else if(!_ambiguous)
+		return -1;
+
+	// values that are not distinguishable by their string representation
+	for(auto i = 0; i < _elements.size(); i++) {
+		if(_elements[i].value == value)
+			return i;
+	}
+	return -1;
+}
@@ -0,0 +1,40 @@
+#ifndef QTMVVM_LISTELEMENTS_P_H
+#define QTMVVM_LISTELEMENTS_P_H
+
+#include <QtCore/QVariant>
+#include <QtCore/QHash>
+#include <QtCore/QVector>
+
+#include "qtmvvmcore_global.h"
+
+namespace QtMvvm {
+
+// the parsed listElements of a list input, with a value lookup that is shared by the widgets and quick models
+class Q_MVVMCORE_EXPORT ListElements
+{
+public:
+	struct Element {
+		QString name;
+		QVariant value;
+	};
+
+	ListElements() = default;
+	explicit ListElements(const QVariantList &listElements);
+
+	QVariantList listElements() const;
+	int size() const;
+	const Element &at(int index) const;
+
+	// index of the first element with the value, or -1
+	int indexOf(const QVariant &value) const;
+
+private:
+	QVariantList _listElements;
+	QVector<Element> _elements;
+	QHash<QString, int> _valueIndexes;
+	bool _ambiguous = false;
+};
+
+}
+
+#endif // QTMVVM_LISTELEMENTS_P_H
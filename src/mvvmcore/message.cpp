@@ -2,6 +2,7 @@
 #include "message_p.h"
 #include "coreapp.h"
 #include "qtmvvm_logging_p.h"
+#include "flightrecorder.h"
 
 #include <QtCore/QtMath>
 #include <QtGui/QGuiApplication>
@@ -13,6 +14,7 @@ const QByteArray MessageConfig::TypeInputDialog = "input";
 const QByteArray MessageConfig::TypeFileDialog = "file";
 const QByteArray MessageConfig::TypeColorDialog = "color";
 const QByteArray MessageConfig::TypeProgressDialog = "progress";
+const QByteArray MessageConfig::TypeNotification = "notification";
 
 const QByteArray MessageConfig::SubTypeInformation = "information";
 const QByteArray MessageConfig::SubTypeWarning = "warning";
@@ -92,6 +94,27 @@ QVariantMap MessageConfig::viewProperties() const
 	return d->editProperties;
 }
 
+QString MessageConfig::buttonText(StandardButton button) const
+{
+	return d->buttonTexts.value(button);
+}
+
+bool MessageConfig::hasViewProperty(const QString &key) const
+{
+	return d->editProperties.contains(key);
+}
+
+QVariant MessageConfig::viewProperty(const QString &key, const QVariant &defaultValue) const
+{
+	return d->editProperties.value(key, defaultValue);
+}
+
+QVariant MessageConfig::viewProperty(CommonViewProperty property, const QVariant &defaultValue) const
+{
+	auto value = commonViewProperty(property);
+	return value ? *value : defaultValue;
+}
+
 MessageConfig &MessageConfig::setType(const QByteArray &type)
 {
 	d->type = type;
@@ -158,18 +181,23 @@ MessageConfig &MessageConfig::setDefaultValue(const QVariant &defaultValue)
 MessageConfig &MessageConfig::setViewProperties(const QVariantMap &editProperties)
 {
 	d->editProperties = editProperties;
+	d->updateCommonProperties();
 	return (*this);
 }
 
 MessageConfig &MessageConfig::setViewProperty(const QString &key, const QVariant &value)
 {
 	d->editProperties.insert(key, value);
+	auto cIndex = MessageConfigPrivate::commonIndex(key);
+	if(cIndex != -1)
+		d->commonProperties[cIndex] = value;
 	return (*this);
 }
 
 MessageConfig &MessageConfig::resetSubType()
 {
-	if(d->type == TypeMessageBox)
+	if(d->type == TypeMessageBox ||
+	   d->type == TypeNotification)
 		d->subType = SubTypeInformation;
 	else if(d->type == TypeInputDialog)
 		d->subType = QMetaType::typeName(QMetaType::QString);
@@ -192,6 +220,8 @@ MessageConfig &MessageConfig::resetButtons()
 		d->buttons = Ok | Cancel;
 	else if(d->type == TypeProgressDialog)
 		d->buttons = Cancel;
+	else if(d->type == TypeNotification)
+		d->buttons = NoButton;
 	else
 		d->buttons = Ok;
 
@@ -215,6 +245,13 @@ void MessageConfig::setButtonTextsMap(const QVariantMap &buttonTexts)
 	setButtonTexts(map);
 }
 
+const QVariant *MessageConfig::commonViewProperty(CommonViewProperty property) const
+{
+	Q_ASSERT_X(property >= 0 && property < CommonViewPropertyCount, Q_FUNC_INFO, "Invalid common view property");
+	const auto &value = d->commonProperties[property];
+	return value.isValid() ? &value : nullptr;
+}
+
 
 
 MessageResult::MessageResult() :
@@ -266,6 +303,7 @@ void MessageResult::setCloseTarget(QObject *closeObject, const QMetaMethod &clos
 
 void MessageResult::complete(MessageConfig::StandardButton button)
 {
+	FlightRecorder::record(FlightRecorder::DialogDone, nullptr, static_cast<quint32>(button));
 	QMetaObject::invokeMethod(this, "dialogDone", Qt::QueuedConnection,
 							  Q_ARG(QtMvvm::MessageConfig::StandardButton, button));
 	QMutexLocker lock(&d->mutex);
@@ -413,6 +451,37 @@ QtMvvm::MessageConfigPrivate::MessageConfigPrivate(QByteArray type, QByteArray s
 
 QtMvvm::MessageConfigPrivate::MessageConfigPrivate(const QtMvvm::MessageConfigPrivate &other) = default;
 
+int MessageConfigPrivate::commonIndex(const QString &key)
+{
+	static const std::array<QLatin1String, MessageConfig::CommonViewPropertyCount> commonKeys {
+		QLatin1String{"modal"},
+		QLatin1String{"windowTitle"},
+		QLatin1String{"details"},
+		QLatin1String{"checkable"},
+		QLatin1String{"checkString"},
+		QLatin1String{"addQtVersion"},
+		QLatin1String{"showQtHelp"},
+		QLatin1String{"repeatCount"}
+	};
+	for(auto i = 0; i < MessageConfig::CommonViewPropertyCount; i++) {
+		if(key == commonKeys[i])
+			return i;
+	}
+	return -1;
+}
+
+void MessageConfigPrivate::updateCommonProperties()
+{
+	commonProperties.fill({});
+	for(auto it = editProperties.constBegin(); it != editProperties.constEnd(); it++) {
+		auto cIndex = commonIndex(it.key());
+		if(cIndex != -1)
+			commonProperties[cIndex] = it.value();
+	}
+}
+
+
+
 // ------------- Namespace methods implementation -------------
 
 MessageResult *QtMvvm::information(const QString &title, const QString &text, const QString &okText)
@@ -582,6 +651,14 @@ MessageResult *QtMvvm::about(const QString &description, const QUrl &websiteUrl,
 	return CoreApp::showDialog(config);
 }
 
+void QtMvvm::notify(const QString &text, const QByteArray &subType, const QString &title)
+{
+	MessageConfig config(MessageConfig::TypeNotification, subType);
+	config.setTitle(title);
+	config.setText(text);
+	CoreApp::showNotification(config);
+}
+
 MessageResult *QtMvvm::getInput(const QString &title, const QString &text, const char *inputType, const QVariant &defaultValue, const QVariantMap &viewProperties, const QString &okText, const QString &cancelText)
 {
 	MessageConfig config(MessageConfig::TypeInputDialog, inputType);
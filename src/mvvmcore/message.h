@@ -68,6 +68,21 @@ public:
 	Q_DECLARE_FLAGS(StandardButtons, StandardButton)
 	Q_FLAG(StandardButtons)
 
+	//! Well known view properties that can be read without a string lookup
+	enum CommonViewProperty {
+		ModalProperty = 0, //!< The `modal` view property
+		WindowTitleProperty, //!< The `windowTitle` view property
+		DetailsProperty, //!< The `details` view property
+		CheckableProperty, //!< The `checkable` view property
+		CheckStringProperty, //!< The `checkString` view property
+		AddQtVersionProperty, //!< The `addQtVersion` view property
+		ShowQtHelpProperty, //!< The `showQtHelp` view property
+		RepeatCountProperty, //!< The `repeatCount` view property
+
+		CommonViewPropertyCount //!< The number of common view properties. Not a valid value
+	};
+	Q_ENUM(CommonViewProperty)
+
 	/**
 	 * @name Possible standard values for MessageConfig::type
 	 * @{
@@ -82,6 +97,8 @@ public:
 	static const QByteArray TypeColorDialog;
 	//! A type to show a generic progress dialog
 	static const QByteArray TypeProgressDialog;
+	//! A type to show a lightweight, non-modal notification
+	static const QByteArray TypeNotification;
 	//! @}
 
 	/**
@@ -164,6 +181,18 @@ public:
 	//! @readAcFn{MessageConfig::viewProperties}
 	QVariantMap viewProperties() const;
 
+	//! Returns the text of the given button, or a null string if the default text should be used
+	QString buttonText(StandardButton button) const;
+	//! Checks if the view property with the given key is set
+	bool hasViewProperty(const QString &key) const;
+	//! Returns the view property with the given key, without copying the viewProperties
+	QVariant viewProperty(const QString &key, const QVariant &defaultValue = {}) const;
+	//! Returns the given common view property, without a string lookup
+	QVariant viewProperty(CommonViewProperty property, const QVariant &defaultValue = {}) const;
+	//! Returns the given common view property converted to T, without a string lookup
+	template <typename T>
+	T viewProperty(CommonViewProperty property, const T &defaultValue = {}) const;
+
 	//! @writeAcFn{MessageConfig::type}
 	MessageConfig &setType(const QByteArray &type);
 	//! @writeAcFn{MessageConfig::subType}
@@ -195,6 +224,8 @@ public:
 private:
 	QSharedDataPointer<MessageConfigPrivate> d;
 
+	const QVariant *commonViewProperty(CommonViewProperty property) const;
+
 	QVariantMap buttonTextsMap() const;
 	void setButtonTextsMap(const QVariantMap &buttonTexts);
 };
@@ -259,6 +290,13 @@ private:
 	QScopedPointer<MessageResultPrivate> d;
 };
 
+template<typename T>
+T MessageConfig::viewProperty(CommonViewProperty property, const T &defaultValue) const
+{
+	auto value = commonViewProperty(property);
+	return value ? value->template value<T>() : defaultValue;
+}
+
 class ProgressControlPrivate;
 //! A Helper class to control a generic progress dialog
 class Q_MVVMCORE_EXPORT ProgressControl : public QObject
@@ -437,6 +475,16 @@ Q_MVVMCORE_EXPORT MessageResult *about(const QString &description,
 									   const QString &extraBottomInfos = QString());
 //! @}
 
+/**
+ * @name Methods to show non-modal notifications (MessageConfig::TypeNotification)
+ * @{
+ */
+//! @brief A shortcut to show a notification, like a toast or a status bar message
+Q_MVVMCORE_EXPORT void notify(const QString &text,
+							  const QByteArray &subType = MessageConfig::SubTypeInformation,
+							  const QString &title = {});
+//! @}
+
 /**
  * @name Methods to show simple input dialogs (MessageConfig::TypeInputDialog)
  * @{
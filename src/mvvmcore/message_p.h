@@ -7,6 +7,8 @@
 #include <QtCore/QMutex>
 #include <QtCore/QAtomicInteger>
 
+#include <array>
+
 #include "qtmvvmcore_global.h"
 #include "message.h"
 
@@ -26,6 +28,11 @@ public:
 	QHash<MessageConfig::StandardButton, QString> buttonTexts;
 	QVariant defaultValue;
 	QVariantMap editProperties;
+	// mirrors the common entries of editProperties. Invalid if not set
+	std::array<QVariant, MessageConfig::CommonViewPropertyCount> commonProperties;
+
+	static int commonIndex(const QString &key);
+	void updateCommonProperties();
 };
 
 class MessageResultPrivate
@@ -19,13 +19,20 @@ HEADERS += \
 	message.h \
 	message_p.h \
 	settingssetup.h \
+	settingssetup_p.h \
 	settingsviewmodel_p.h \
 	settingsviewmodel.h \
 	injection.h \
 	isettingsaccessor.h \
 	qsettingsaccessor.h \
+	snapshotsettingsaccessor.h \
 	settingsentry.h \
 	settingsconfigloader_p.h \
+	flightrecorder.h \
+	stalldetector.h \
+	viewmodeltracker.h \
+	viewmodeltracker_p.h \
+	listelements_p.h \
     exception.h
 
 SOURCES += \
@@ -39,8 +46,14 @@ SOURCES += \
 	settingsviewmodel.cpp \
 	isettingsaccessor.cpp \
 	qsettingsaccessor.cpp \
+	snapshotsettingsaccessor.cpp \
 	settingsentry.cpp \
-	settingsconfigloader.cpp
+	settingsconfigloader.cpp \
+	settingssetup.cpp \
+	flightrecorder.cpp \
+	stalldetector.cpp \
+	viewmodeltracker.cpp \
+	listelements.cpp
 
 android {
 	QT += androidextras
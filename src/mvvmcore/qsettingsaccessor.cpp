@@ -1,4 +1,8 @@
 #include "qsettingsaccessor.h"
+#include "qtmvvm_logging_p.h"
+#include <QtCore/QFileSystemWatcher>
+#include <QtCore/QFileInfo>
+#include <QtCore/QTimer>
 using namespace QtMvvm;
 
 namespace QtMvvm {
@@ -9,6 +13,14 @@ public:
 	QSettingsAccessorPrivate(QSettings *settings);
 
 	QSettings *settings;
+
+	QFileSystemWatcher *watcher = nullptr;
+	QTimer *watchTimer = nullptr;
+	// the last known state of the settings file, to detect what changed
+	QHash<QString, QVariant> index;
+
+	void watchFile();
+	void rebuildIndex();
 };
 
 }
@@ -39,6 +51,8 @@ QVariant QSettingsAccessor::load(const QString &key, const QVariant &defaultValu
 void QSettingsAccessor::save(const QString &key, const QVariant &value)
 {
 	d->settings->setValue(key, value);
+	if(d->watcher)
+		d->index.insert(key, value);
 	emit entryChanged(key, value);
 }
 
@@ -48,6 +62,11 @@ void QSettingsAccessor::remove(const QString &key)
 	auto allKeys = d->settings->allKeys();
 	d->settings->endGroup();
 	d->settings->remove(key);
+	if(d->watcher) {
+		d->index.remove(key);
+		for(const auto &subKey : allKeys)
+			d->index.remove(key + QLatin1Char('/') + subKey);
+	}
 	for(const auto &subKey : allKeys)
 		emit entryRemoved(key + QLatin1Char('/') + subKey);
 	emit entryRemoved(key);
@@ -58,13 +77,96 @@ QSettings *QSettingsAccessor::settings() const
 	return d->settings;
 }
 
+bool QSettingsAccessor::watchChanges() const
+{
+	return d->watcher;
+}
+
 void QSettingsAccessor::sync()
 {
 	d->settings->sync();
 }
 
+void QSettingsAccessor::setWatchChanges(bool watchChanges)
+{
+	if(watchChanges == static_cast<bool>(d->watcher))
+		return;
+
+	if(watchChanges) {
+		if(!QFileInfo{d->settings->fileName()}.isAbsolute()) {
+			logWarning() << "Unable to watch settings" << d->settings->fileName()
+						 << "- only file based settings can be watched";
+			return;
+		}
+
+		d->watcher = new QFileSystemWatcher{this};
+		d->watchTimer = new QTimer{this};
+		// editors and QSettings replace the file, so multiple events are merged into one check
+		d->watchTimer->setInterval(50);
+		d->watchTimer->setSingleShot(true);
+		connect(d->watcher, &QFileSystemWatcher::fileChanged,
+				d->watchTimer, QOverload<>::of(&QTimer::start));
+		connect(d->watcher, &QFileSystemWatcher::directoryChanged,
+				d->watchTimer, QOverload<>::of(&QTimer::start));
+		connect(d->watchTimer, &QTimer::timeout,
+				this, &QSettingsAccessor::checkFileChanges);
+
+		d->settings->sync();
+		d->rebuildIndex();
+		d->watchFile();
+	} else {
+		d->watcher->deleteLater();
+		d->watcher = nullptr;
+		d->watchTimer->deleteLater();
+		d->watchTimer = nullptr;
+		d->index.clear();
+	}
+	emit watchChangesChanged(watchChanges, {});
+}
+
+void QSettingsAccessor::checkFileChanges()
+{
+	d->settings->sync();
+	d->watchFile(); // replaced files are dropped by the watcher
+
+	QHash<QString, QVariant> newIndex;
+	const auto allKeys = d->settings->allKeys();
+	newIndex.reserve(allKeys.size());
+	for(const auto &key : allKeys) {
+		auto value = d->settings->value(key);
+		auto oldIt = d->index.constFind(key);
+		if(oldIt == d->index.constEnd() || *oldIt != value)
+			emit entryChanged(key, value);
+		newIndex.insert(key, std::move(value));
+	}
+	for(auto it = d->index.constBegin(); it != d->index.constEnd(); ++it) {
+		if(!newIndex.contains(it.key()))
+			emit entryRemoved(it.key());
+	}
+	d->index = std::move(newIndex);
+}
+
 
 
 QSettingsAccessorPrivate::QSettingsAccessorPrivate(QSettings *settings) :
 	settings{settings}
 {}
+
+void QSettingsAccessorPrivate::watchFile()
+{
+	QFileInfo info{settings->fileName()};
+	// the directory is watched as well, to detect the file being created or replaced
+	if(!watcher->directories().contains(info.absolutePath()))
+		watcher->addPath(info.absolutePath());
+	if(info.exists() && !watcher->files().contains(info.absoluteFilePath()))
+		watcher->addPath(info.absoluteFilePath());
+}
+
+void QSettingsAccessorPrivate::rebuildIndex()
+{
+	index.clear();
+	const auto allKeys = settings->allKeys();
+	index.reserve(allKeys.size());
+	for(const auto &key : allKeys)
+		index.insert(key, settings->value(key));
+}
@@ -16,6 +16,9 @@ class Q_MVVMCORE_EXPORT QSettingsAccessor : public ISettingsAccessor
 	Q_OBJECT
 	Q_INTERFACES(QtMvvm::ISettingsAccessor)
 
+	//! Specifies if changes of the settings file done by other instances or processes are detected
+	Q_PROPERTY(bool watchChanges READ watchChanges WRITE setWatchChanges NOTIFY watchChangesChanged)
+
 public:
 	//! Default Constructor
 	Q_INVOKABLE explicit QSettingsAccessor(QObject *parent = nullptr);
@@ -31,10 +34,23 @@ public:
 	//! Returns the internally used settings
 	QSettings *settings() const;
 
+	//! @readAcFn{QSettingsAccessor::watchChanges}
+	bool watchChanges() const;
+
 public Q_SLOTS:
 	//! @copydoc ISettingsAccessor::sync
 	void sync() override;
 
+	//! @writeAcFn{QSettingsAccessor::watchChanges}
+	void setWatchChanges(bool watchChanges);
+
+Q_SIGNALS:
+	//! @notifyAcFn{QSettingsAccessor::watchChanges}
+	void watchChangesChanged(bool watchChanges, QPrivateSignal);
+
+private Q_SLOTS:
+	void checkFileChanges();
+
 private:
 	QScopedPointer<QSettingsAccessorPrivate> d;
 };
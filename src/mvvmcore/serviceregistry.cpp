@@ -1,12 +1,17 @@
 #include "serviceregistry.h"
 #include "serviceregistry_p.h"
 #include "qtmvvm_logging_p.h"
+#include "stalldetector.h"
 
 #include <QtCore/QGlobalStatic>
 #include <QtCore/QRegularExpression>
 #include <QtCore/QMetaProperty>
 #include <QtCore/QCoreApplication>
 #include <QtCore/QThread>
+#include <QtCore/QThreadPool>
+#include <QtCore/QRunnable>
+#include <QtCore/QSemaphore>
+#include <QtCore/QMap>
 
 #include <qpluginfactory.h>
 
@@ -47,6 +52,7 @@ void ServiceRegistry::registerService(const QByteArray &iid, const QMetaObject *
 	QMutexLocker _(&d->serviceMutex);
 	if(d->serviceBlocked(iid))
 		throw ServiceExistsException(iid);
+	d->verifyConstructorLocked(metaObject);
 	d->services.insert(iid, QSharedPointer<ServiceRegistryPrivate::MetaServiceInfo>::create(metaObject, weak, scope));
 }
 
@@ -84,11 +90,7 @@ void ServiceRegistry::registerService(QByteArray iid, QString pluginType, QStrin
 QObject *ServiceRegistry::serviceObj(const QByteArray &iid)
 {
 	QMutexLocker _(&d->serviceMutex);
-	auto ref = d->services.value(iid);
-	if(ref)
-		return ref->instance(d.data(), iid);
-	else
-		throw ServiceDependencyException(iid);
+	return d->dependencyLocked(iid);
 }
 
 void ServiceRegistry::injectServices(QObject *object)
@@ -103,8 +105,79 @@ QObject *ServiceRegistry::constructInjected(const QMetaObject *metaObject, QObje
 	return d->constructInjectedLocked(metaObject, parent);
 }
 
+void ServiceRegistry::registerTypedService(const QByteArray &iid, const QMetaObject *metaObject, Constructor constructor, DestructionScope scope, bool weak)
+{
+	QMutexLocker _(&d->serviceMutex);
+	if(d->serviceBlocked(iid))
+		throw ServiceExistsException(iid);
+	if(constructor)
+		d->constructors.insert(metaObject, constructor);
+	else
+		d->verifyConstructorLocked(metaObject);
+	d->services.insert(iid, QSharedPointer<ServiceRegistryPrivate::MetaServiceInfo>::create(metaObject, weak, scope));
+}
+
+QObject *ServiceRegistry::constructTypedInjected(const QMetaObject *metaObject, Constructor constructor, QObject *parent)
+{
+	QMutexLocker _(&d->serviceMutex);
+	if(constructor)
+		d->constructors.insert(metaObject, constructor);
+	return d->constructInjectedLocked(metaObject, parent);
+}
+
+int ServiceRegistry::shutdownTimeout() const
+{
+	QMutexLocker _(&d->serviceMutex);
+	return d->shutdownTimeout;
+}
+
+void ServiceRegistry::setShutdownTimeout(int msecs)
+{
+	QMutexLocker _(&d->serviceMutex);
+	d->shutdownTimeout = msecs;
+}
+
+bool ServiceRegistry::isFastExit() const
+{
+	QMutexLocker _(&d->serviceMutex);
+	return d->fastExit;
+}
+
+void ServiceRegistry::setFastExit(bool fastExit)
+{
+	QMutexLocker _(&d->serviceMutex);
+	d->fastExit = fastExit;
+}
+
 // ------------- Private Implementation -------------
 
+namespace {
+
+class ShutdownHookRunner : public QRunnable
+{
+public:
+	ShutdownHookRunner(QObject *instance, QMetaMethod hook, QSharedPointer<QAtomicInt> finished, QSharedPointer<QSemaphore> done) :
+		_instance{instance},
+		_hook{std::move(hook)},
+		_finished{std::move(finished)},
+		_done{std::move(done)}
+	{}
+
+	void run() override {
+		_hook.invoke(_instance, Qt::DirectConnection);
+		_finished->storeRelease(1);
+		_done->release();
+	}
+
+private:
+	QObject *_instance;
+	QMetaMethod _hook;
+	QSharedPointer<QAtomicInt> _finished;
+	QSharedPointer<QSemaphore> _done;
+};
+
+}
+
 bool ServiceRegistryPrivate::serviceBlocked(const QByteArray &iid) const
 {
 	auto svc = services.value(iid);
@@ -116,11 +189,14 @@ bool ServiceRegistryPrivate::serviceBlocked(const QByteArray &iid) const
 
 QObject *ServiceRegistryPrivate::constructInjectedLocked(const QMetaObject *metaObject, QObject *parent)
 {
-	auto instance = metaObject->newInstance(Q_ARG(QObject*, parent));
-	if(!instance) {
-		throw ServiceConstructionException(QByteArrayLiteral("Failed to construct object of type ") +
-										   metaObject->className() +
-										   QByteArrayLiteral(" - make sure there is an invokable constructor of the format: Q_INVOKABLE MyClass(QObject*)"));
+	QObject *instance = nullptr;
+	auto constructor = constructors.value(metaObject);
+	if(constructor)
+		instance = constructor(parent);
+	else {
+		instance = metaObject->newInstance(Q_ARG(QObject*, parent));
+		if(!instance)
+			throw missingConstructorException(metaObject);
 	}
 
 	try {
@@ -132,6 +208,27 @@ QObject *ServiceRegistryPrivate::constructInjectedLocked(const QMetaObject *meta
 	}
 }
 
+void ServiceRegistryPrivate::verifyConstructorLocked(const QMetaObject *metaObject) const
+{
+	if(constructors.contains(metaObject))
+		return;
+
+	// same lookup as QMetaObject::newInstance, so a missing constructor is reported on registration
+	QByteArray className = metaObject->className();
+	auto nsIndex = className.lastIndexOf(':');
+	if(nsIndex != -1)
+		className = className.mid(nsIndex + 1);
+	if(metaObject->indexOfConstructor(className + "(QObject*)") == -1)
+		throw missingConstructorException(metaObject);
+}
+
+ServiceConstructionException ServiceRegistryPrivate::missingConstructorException(const QMetaObject *metaObject)
+{
+	return ServiceConstructionException{QByteArrayLiteral("Failed to construct object of type ") +
+										metaObject->className() +
+										QByteArrayLiteral(" - make sure there is an invokable constructor of the format: Q_INVOKABLE MyClass(QObject*)")};
+}
+
 void ServiceRegistryPrivate::injectLocked(QObject *object)
 {
 	static QRegularExpression nameRegex(QStringLiteral(R"__(^__qtmvvm_inject_(.+)$)__"));
@@ -151,10 +248,7 @@ void ServiceRegistryPrivate::injectLocked(QObject *object)
 			auto tProp = metaObject->property(tPropIndex);
 
 			auto iid = prop.read(object).toByteArray();
-			auto ref = services.value(iid);
-			if(!ref)
-				throw ServiceDependencyException(iid);
-			auto injObj = ref->instance(this, iid);
+			auto injObj = dependencyLocked(iid);
 			auto variant = QVariant::fromValue(injObj);
 			if(!variant.convert(tProp.userType())) {
 				throw ServiceConstructionException("Failed to convert QObject to interface with iid \"" +
@@ -174,20 +268,160 @@ void ServiceRegistryPrivate::injectLocked(QObject *object)
 	}
 }
 
+QObject *ServiceRegistryPrivate::dependencyLocked(const QByteArray &iid)
+{
+	auto ref = services.value(iid);
+	if(!ref)
+		throw ServiceDependencyException(iid);
+	if(dependencyRecorder)
+		dependencyRecorder->append(iid);
+	return ref->instance(this, iid);
+}
+
 void ServiceRegistryPrivate::destroyServices(ServiceRegistry::DestructionScope scope)
 {
-	QMutexLocker _(&serviceMutex);
-	logDebug() << "Beginning destruction for services in scope:" << scope;
-	for(auto it = services.begin(); it != services.end();) {
-		if(it.value()->needsDestroy(scope)) {
-			logDebug() << "Destroying service:" << it.key();
-			it = services.erase(it);
-		} else
-			it++;
+	QHash<QByteArray, QSharedPointer<ServiceInfo>> destroyed;
+	QDeadlineTimer deadline;
+	auto skipFree = false;
+	{
+		QMutexLocker _(&serviceMutex);
+		logDebug() << "Beginning destruction for services in scope:" << scope;
+		for(auto it = services.begin(); it != services.end();) {
+			if(it.value()->needsDestroy(scope)) {
+				destroyed.insert(it.key(), it.value());
+				it = services.erase(it);
+			} else
+				it++;
+		}
+		deadline.setRemainingTime(shutdownTimeout);
+		skipFree = fastExit && scope == ServiceRegistry::DestroyOnAppDestroy;
+	}
+
+	// the lock is not held from here on, so shutdown hooks can still use the registry
+	const auto allDestroyed = destroyed;
+	QSet<QByteArray> leaked;
+	for(const auto &batch : shutdownOrder(destroyed)) {
+		QObjectList instances;
+		QHash<QObject*, QByteArray> instanceIids;
+		instances.reserve(batch.size());
+		for(const auto &iid : batch) {
+			auto instance = destroyed.value(iid)->currentInstance();
+			if(instance) {
+				instances.append(instance);
+				instanceIids.insert(instance, iid);
+			}
+		}
+
+		const auto unfinished = runShutdownHooks(instances, deadline);
+		if(!unfinished.isEmpty()) {
+			QByteArrayList unfinishedIids;
+			for(auto instance : unfinished) {
+				const auto iid = instanceIids.value(instance);
+				unfinishedIids.append(iid);
+				markLeaked(allDestroyed, iid, leaked);
+			}
+			logWarning() << "Shutdown hooks of services" << unfinishedIids
+						 << "in scope" << scope
+						 << "did not finish in time - they and their dependencies will not be deleted";
+		}
+
+		for(const auto &iid : batch) {
+			auto info = destroyed.take(iid);
+			// with hooks still running or in fast exit mode, the memory is left to the operating system
+			if(skipFree || leaked.contains(iid))
+				info->release();
+			else
+				logDebug() << "Destroying service:" << iid;
+		}
 	}
 	logDebug() << "Finished destruction for services in scope:" << scope;
 }
 
+void ServiceRegistryPrivate::markLeaked(const QHash<QByteArray, QSharedPointer<ServiceInfo>> &services, const QByteArray &iid, QSet<QByteArray> &leaked)
+{
+	auto info = services.value(iid);
+	if(!info || leaked.contains(iid))
+		return;
+	leaked.insert(iid);
+	for(const auto &dep : info->dependencies())
+		markLeaked(services, dep, leaked);
+}
+
+QList<QByteArrayList> ServiceRegistryPrivate::shutdownOrder(const QHash<QByteArray, QSharedPointer<ServiceInfo>> &services)
+{
+	// a service must be destroyed before all the services it depends on, i.e. its rank must be lower
+	QHash<QByteArray, int> ranks;
+	ranks.reserve(services.size());
+	for(auto it = services.constBegin(); it != services.constEnd(); ++it)
+		ranks.insert(it.key(), 0);
+	// limited to the number of services, in case of cyclic dependencies
+	for(auto i = 0, changed = 1; changed && i < services.size(); i++) {
+		changed = 0;
+		for(auto it = services.constBegin(); it != services.constEnd(); ++it) {
+			const auto rank = ranks.value(it.key());
+			for(const auto &dep : it.value()->dependencies()) {
+				auto depIt = ranks.find(dep);
+				if(depIt != ranks.end() && *depIt <= rank) {
+					*depIt = rank + 1;
+					changed++;
+				}
+			}
+		}
+	}
+
+	QMap<int, QByteArrayList> batches;
+	for(auto it = ranks.constBegin(); it != ranks.constEnd(); ++it)
+		batches[it.value()].append(it.key());
+	return batches.values();
+}
+
+QObjectList ServiceRegistryPrivate::runShutdownHooks(const QObjectList &instances, const QDeadlineTimer &deadline)
+{
+	QList<QPair<QObject*, QMetaMethod>> hooks;
+	for(auto instance : instances) {
+		auto hookIndex = instance->metaObject()->indexOfMethod("qtmvvm_aboutToDestroy()");
+		if(hookIndex != -1)
+			hooks.append({instance, instance->metaObject()->method(hookIndex)});
+	}
+	if(hooks.isEmpty())
+		return {};
+
+	// without an application the registry is destroyed with the static objects, no threads are started then
+	if(!QCoreApplication::instance()) {
+		for(const auto &hook : qAsConst(hooks))
+			hook.second.invoke(hook.first, Qt::DirectConnection);
+		return {};
+	}
+
+	// a private pool, with a thread for every hook, so no hook waits for another one to finish
+	auto pool = new QThreadPool{};
+	pool->setMaxThreadCount(hooks.size());
+	// shared with the runners, as runners that did not finish in time may still use them
+	auto done = QSharedPointer<QSemaphore>::create();
+	QList<QSharedPointer<QAtomicInt>> finished;
+	finished.reserve(hooks.size());
+	for(const auto &hook : qAsConst(hooks)) {
+		finished.append(QSharedPointer<QAtomicInt>::create(0));
+		pool->start(new ShutdownHookRunner{hook.first, hook.second, finished.last(), done});
+	}
+
+	if(done->tryAcquire(hooks.size(), static_cast<int>(deadline.remainingTime()))) {
+		delete pool;
+		return {};
+	}
+
+	// the pool is abandoned, as destroying it would wait for the hooks that still run
+	QObjectList unfinished;
+	for(auto i = 0; i < hooks.size(); i++) {
+		if(finished[i]->loadAcquire() == 0)
+			unfinished.append(hooks[i].first);
+	}
+	// a hook may finish between the failed wait and the check above
+	if(unfinished.isEmpty())
+		delete pool;
+	return unfinished;
+}
+
 void ServiceRegistryPrivate::appDestroyedHook()
 {
 	if(_instance.exists() && !_instance.isDestroyed())
@@ -228,18 +462,44 @@ bool ServiceRegistryPrivate::ServiceInfo::needsDestroy(ServiceRegistry::Destruct
 QObject *ServiceRegistryPrivate::ServiceInfo::instance(ServiceRegistryPrivate *d, const QByteArray &iid)
 {
 	if(!_instance) {
-		_instance = construct(d);
+		StallDetector::Scope stallScope{StallDetector::ServiceConstruction, iid.constData()};
+		QByteArrayList dependencies;
+		auto recorder = d->dependencyRecorder;
+		d->dependencyRecorder = &dependencies;
+		try {
+			_instance = construct(d);
+		} catch(...) {
+			d->dependencyRecorder = recorder;
+			throw;
+		}
+		d->dependencyRecorder = recorder;
 		if(!_instance)
 			throw ServiceConstructionException("Failed to construct service of type " +
 											   iid +
 											   " with unknown error");
 		if(_instance->thread() != qApp->thread())
 			_instance->moveToThread(qApp->thread());
+		_dependencies = std::move(dependencies);
 		logDebug() << "Constructed service of type" << iid;
 	}
 	return _instance;
 }
 
+QObject *ServiceRegistryPrivate::ServiceInfo::currentInstance() const
+{
+	return _instance;
+}
+
+const QByteArrayList &ServiceRegistryPrivate::ServiceInfo::dependencies() const
+{
+	return _dependencies;
+}
+
+void ServiceRegistryPrivate::ServiceInfo::release()
+{
+	_instance = nullptr;
+}
+
 
 
 ServiceRegistryPrivate::FnServiceInfo::FnServiceInfo(std::function<QObject*(QObjectList)> &&creator, QByteArrayList &&injectables, bool weak, ServiceRegistry::DestructionScope scope) :
@@ -252,12 +512,8 @@ QObject *ServiceRegistryPrivate::FnServiceInfo::construct(ServiceRegistryPrivate
 {
 	QObjectList params;
 	params.reserve(_injectables.size());
-	for(const auto &iid : _injectables) {
-		auto ref = d->services.value(iid);
-		if(!ref)
-			throw ServiceDependencyException(iid);
-		params.append(ref->instance(d, iid));
-	}
+	for(const auto &iid : _injectables)
+		params.append(d->dependencyLocked(iid));
 	return _creator(params);
 }
 
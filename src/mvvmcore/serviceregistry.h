@@ -2,6 +2,7 @@
 #define QTMVVM_SERVICEREGISTRY_H
 
 #include <functional>
+#include <type_traits>
 
 #include <QtCore/qscopedpointer.h>
 #include <QtCore/qvariant.h>
@@ -102,9 +103,34 @@ public:
 	//! Constructs a new instance of metaObject with properties injected
 	QObject *constructInjected(const QMetaObject *metaObject, QObject *parent = nullptr);
 
+	//! Returns the time in milliseconds the registry waits for the shutdown hooks of services
+	int shutdownTimeout() const;
+	//! Sets the time in milliseconds the registry waits for the shutdown hooks of services
+	void setShutdownTimeout(int msecs);
+	//! Checks if services of the DestroyOnAppDestroy scope are left to the operating system on shutdown
+	bool isFastExit() const;
+	//! Sets if services of the DestroyOnAppDestroy scope are left to the operating system on shutdown
+	void setFastExit(bool fastExit);
+
 private:
 	friend class QtMvvm::ServiceRegistryPrivate;
 	QScopedPointer<ServiceRegistryPrivate> d;
+
+	using Constructor = QObject*(*)(QObject*);
+
+	template <typename TClass>
+	static QObject *constructTyped(QObject *parent);
+	template <typename TClass>
+	static Constructor typedConstructor(std::true_type);
+	template <typename TClass>
+	static Constructor typedConstructor(std::false_type);
+
+	void registerTypedService(const QByteArray &iid,
+							  const QMetaObject *metaObject,
+							  Constructor constructor,
+							  DestructionScope scope,
+							  bool weak);
+	QObject *constructTypedInjected(const QMetaObject *metaObject, Constructor constructor, QObject *parent);
 };
 
 //! Is thrown if a service is beeing registered that is already registered
@@ -184,7 +210,7 @@ template<typename TInterface, typename TService>
 void ServiceRegistry::registerInterface(DestructionScope scope, bool weak)
 {
 	QTMVVM_SERVICE_ASSERT(TInterface, TService)
-	registerService(qobject_interface_iid<TInterface*>(), &TService::staticMetaObject, scope, weak);
+	registerTypedService(qobject_interface_iid<TInterface*>(), &TService::staticMetaObject, typedConstructor<TService>(std::is_constructible<TService, QObject*>{}), scope, weak);
 }
 
 template <typename TInterface, typename TService, typename TFunc>
@@ -214,7 +240,7 @@ template<typename TService>
 void ServiceRegistry::registerObject(DestructionScope scope, bool weak)
 {
 	QTMVVM_SERVICE_ASSERT(TService)
-	registerService(__helpertypes::qobject_iid<TService*>(), &TService::staticMetaObject, scope, weak);
+	registerTypedService(__helpertypes::qobject_iid<TService*>(), &TService::staticMetaObject, typedConstructor<TService>(std::is_constructible<TService, QObject*>{}), scope, weak);
 }
 
 template<typename TService, typename TFunc>
@@ -254,7 +280,26 @@ template<typename TClass>
 TClass *ServiceRegistry::constructInjected(QObject *parent)
 {
 	static_assert(__helpertypes::is_qobj<TClass>::value, "TClass must be a qobject class");
-	return qobject_cast<TClass*>(constructInjected(&TClass::staticMetaObject, parent));
+	return qobject_cast<TClass*>(constructTypedInjected(&TClass::staticMetaObject, typedConstructor<TClass>(std::is_constructible<TClass, QObject*>{}), parent));
+}
+
+template<typename TClass>
+QObject *ServiceRegistry::constructTyped(QObject *parent)
+{
+	return new TClass(parent);
+}
+
+template<typename TClass>
+ServiceRegistry::Constructor ServiceRegistry::typedConstructor(std::true_type)
+{
+	return &ServiceRegistry::constructTyped<TClass>;
+}
+
+template<typename TClass>
+ServiceRegistry::Constructor ServiceRegistry::typedConstructor(std::false_type)
+{
+	// classes without a public (QObject*) constructor fall back to the invokable one
+	return nullptr;
 }
 
 }
@@ -3,6 +3,8 @@
 
 #include <QtCore/QMutex>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QSet>
+#include <QtCore/QDeadlineTimer>
 
 #include "qtmvvmcore_global.h"
 #include "serviceregistry.h"
@@ -25,6 +27,9 @@ public:
 		bool replaceable() const;
 		bool needsDestroy(ServiceRegistry::DestructionScope scope) const;
 		QObject *instance(ServiceRegistryPrivate *d, const QByteArray &iid);
+		QObject *currentInstance() const;
+		const QByteArrayList &dependencies() const;
+		void release();
 
 	protected:
 		virtual QObject *construct(ServiceRegistryPrivate *d) const = 0;
@@ -34,6 +39,7 @@ public:
 		const ServiceRegistry::DestructionScope _scope;
 		QObject *_instance = nullptr;
 		mutable bool _closingDown = false;
+		QByteArrayList _dependencies;
 	};
 
 	class FnServiceInfo : public ServiceInfo {
@@ -80,14 +86,27 @@ public:
 
 	QMutex serviceMutex{QMutex::Recursive};
 	QHash<QByteArray, QSharedPointer<ServiceInfo>> services;
+	// direct constructors of types registered via the templates, to skip the constructor search
+	QHash<const QMetaObject*, ServiceRegistry::Constructor> constructors;
+	// collects the iids a service uses while it is constructed
+	QByteArrayList *dependencyRecorder = nullptr;
+	int shutdownTimeout = 5000;
+	bool fastExit = false;
 
 	bool serviceBlocked(const QByteArray &iid) const;
+	void verifyConstructorLocked(const QMetaObject *metaObject) const;
 	QObject *constructInjectedLocked(const QMetaObject *metaObject, QObject *parent);
 	void injectLocked(QObject *object);
+	QObject *dependencyLocked(const QByteArray &iid);
 
 	void destroyServices(ServiceRegistry::DestructionScope scope);
+	static QList<QByteArrayList> shutdownOrder(const QHash<QByteArray, QSharedPointer<ServiceInfo>> &services);
+	// returns the instances whose hooks did not finish before the deadline
+	static QObjectList runShutdownHooks(const QObjectList &instances, const QDeadlineTimer &deadline);
+	static void markLeaked(const QHash<QByteArray, QSharedPointer<ServiceInfo>> &services, const QByteArray &iid, QSet<QByteArray> &leaked);
 
 	static void appDestroyedHook();
+	static ServiceConstructionException missingConstructorException(const QMetaObject *metaObject);
 };
 
 }
@@ -1,4 +1,5 @@
 #include "settingsconfigloader_p.h"
+#include "stalldetector.h"
 #include <QtCore/QCoreApplication>
 #include <QtCore/QFileSelector>
 using namespace QtMvvm;
@@ -15,10 +16,22 @@ void SettingsConfigLoader::changeDefaultIcon(const QUrl &defaultIcon)
 }
 
 Setup SettingsConfigLoader::loadSetup(const QString &filePath, const QString &frontend, const QFileSelector *selector) const
+{
+	return loadCached(filePath, frontend, selector)->setup;
+}
+
+FlatSetup SettingsConfigLoader::loadFlatSetup(const QString &filePath, const QString &frontend, const QFileSelector *selector) const
+{
+	return loadCached(filePath, frontend, selector)->flatSetup;
+}
+
+const SettingsConfigLoader::CachedSetup *SettingsConfigLoader::loadCached(const QString &filePath, const QString &frontend, const QFileSelector *selector) const
 {
 	auto keyTuple = std::make_tuple(filePath, frontend, selector->allSelectors());
-	Setup setup;
-	if(!_cache.contains(keyTuple)) {
+	auto cached = _cache.object(keyTuple);
+	if(!cached) {
+		StallDetector::Scope stallScope{StallDetector::SettingsLoading,
+										StallDetector::isRunning() ? qUtf8Printable(filePath) : nullptr};
 		try {
 			const_cast<SettingsConfigLoader*>(this)->setFilters(frontend, selector);
 			auto config = const_cast<SettingsConfigLoader*>(this)->readDocument(filePath);
@@ -27,15 +40,16 @@ Setup SettingsConfigLoader::loadSetup(const QString &filePath, const QString &fr
 			if(!nonstd::holds_alternative<SettingsConfigType>(config))
 				throw SettingsConfigException{"Root Element of \"" + filePath.toUtf8() + "\" must be a SettingsConfig"};
 
-			setup = convertSettings(nonstd::get<SettingsConfigType>(config));
-			_cache.insert(keyTuple, new Setup{setup});
+			cached = new CachedSetup;
+			cached->setup = convertSettings(nonstd::get<SettingsConfigType>(config));
+			cached->flatSetup = FlatSetup{cached->setup};
+			_cache.insert(keyTuple, cached);
 		} catch (Exception &e) {
 			throw SettingsConfigException{e};
 		}
-	} else
-		setup = *(_cache.object(keyTuple));
+	}
 
-	return setup;
+	return cached;
 }
 
 QStringList QtMvvm::SettingsConfigLoader::allSelectors() const
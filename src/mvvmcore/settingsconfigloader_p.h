@@ -22,14 +22,23 @@ public:
 
 	void changeDefaultIcon(const QUrl &defaultIcon) override;
 	SettingsElements::Setup loadSetup(const QString &filePath, const QString &frontend, const QFileSelector *selector) const override;
+	SettingsElements::FlatSetup loadFlatSetup(const QString &filePath, const QString &frontend, const QFileSelector *selector) const;
 
 protected:
 	QStringList allSelectors() const override;
 	QString select(const QString &path) const override;
 
 private:
+	// the expanded setup is kept as well, so loadSetup stays a shallow copy
+	struct CachedSetup {
+		SettingsElements::Setup setup;
+		SettingsElements::FlatSetup flatSetup;
+	};
+
 	QUrl _defaultIcon;
-	mutable QCache<std::tuple<QString, QString, QStringList>, SettingsElements::Setup> _cache;
+	mutable QCache<std::tuple<QString, QString, QStringList>, CachedSetup> _cache;
+
+	const CachedSetup *loadCached(const QString &filePath, const QString &frontend, const QFileSelector *selector) const;
 
 	SettingsElements::Setup convertSettings(const SettingsConfigType &settings) const;
 
@@ -296,6 +296,78 @@ void SettingsEntry<T>::set(const T &value)
 template<>
 Q_MVVMCORE_EXPORT void SettingsEntry<QVariant>::set(const QVariant &value);
 
+template<>
+inline bool SettingsEntry<bool>::get() const
+{
+	return _accessor->loadBool(_key, _default.toBool());
+}
+
+template<>
+inline void SettingsEntry<bool>::set(const bool &value)
+{
+	_accessor->saveBool(_key, value);
+}
+
+template<>
+inline int SettingsEntry<int>::get() const
+{
+	return _accessor->loadInt(_key, _default.toInt());
+}
+
+template<>
+inline void SettingsEntry<int>::set(const int &value)
+{
+	_accessor->saveInt(_key, value);
+}
+
+template<>
+inline qint64 SettingsEntry<qint64>::get() const
+{
+	return _accessor->loadInt64(_key, _default.toLongLong());
+}
+
+template<>
+inline void SettingsEntry<qint64>::set(const qint64 &value)
+{
+	_accessor->saveInt64(_key, value);
+}
+
+template<>
+inline double SettingsEntry<double>::get() const
+{
+	return _accessor->loadDouble(_key, _default.toDouble());
+}
+
+template<>
+inline void SettingsEntry<double>::set(const double &value)
+{
+	_accessor->saveDouble(_key, value);
+}
+
+template<>
+inline QString SettingsEntry<QString>::get() const
+{
+	return _accessor->loadString(_key, _default.toString());
+}
+
+template<>
+inline void SettingsEntry<QString>::set(const QString &value)
+{
+	_accessor->saveString(_key, value);
+}
+
+template<>
+inline QByteArray SettingsEntry<QByteArray>::get() const
+{
+	return _accessor->loadByteArray(_key, _default.toByteArray());
+}
+
+template<>
+inline void SettingsEntry<QByteArray>::set(const QByteArray &value)
+{
+	_accessor->saveByteArray(_key, value);
+}
+
 template<typename T>
 void SettingsEntry<T>::reset()
 {
@@ -0,0 +1,230 @@
+#include "settingssetup.h"
+#include "settingssetup_p.h"
+using namespace QtMvvm;
+using namespace QtMvvm::SettingsElements;
+
+FlatSetup::FlatSetup() :
+	d{new FlatSetupData{}}
+{}
+
+FlatSetup::FlatSetup(const Setup &setup) :
+	d{new FlatSetupData{}}
+{
+	d->build(setup);
+}
+
+FlatSetup::FlatSetup(const FlatSetup &other) = default;
+
+FlatSetup::FlatSetup(FlatSetup &&other) noexcept = default;
+
+FlatSetup::~FlatSetup() = default;
+
+FlatSetup &FlatSetup::operator=(const FlatSetup &other) = default;
+
+FlatSetup &FlatSetup::operator=(FlatSetup &&other) noexcept = default;
+
+bool FlatSetup::allowSearch() const
+{
+	return d->allowSearch;
+}
+
+bool FlatSetup::allowRestore() const
+{
+	return d->allowRestore;
+}
+
+int FlatSetup::categoryCount() const
+{
+	return d->categories.size();
+}
+
+int FlatSetup::sectionCount() const
+{
+	return d->sections.size();
+}
+
+int FlatSetup::groupCount() const
+{
+	return d->groups.size();
+}
+
+int FlatSetup::entryCount() const
+{
+	return d->entries.size();
+}
+
+const Category &FlatSetup::category(int index) const
+{
+	return d->categories.at(index).element;
+}
+
+FlatSetup::Range FlatSetup::categorySections(int categoryIndex) const
+{
+	return d->categories.at(categoryIndex).children;
+}
+
+const Section &FlatSetup::section(int index) const
+{
+	return d->sections.at(index).element;
+}
+
+int FlatSetup::sectionCategory(int sectionIndex) const
+{
+	return d->sections.at(sectionIndex).parent;
+}
+
+FlatSetup::Range FlatSetup::sectionGroups(int sectionIndex) const
+{
+	return d->sections.at(sectionIndex).children;
+}
+
+const Group &FlatSetup::group(int index) const
+{
+	return d->groups.at(index).element;
+}
+
+int FlatSetup::groupSection(int groupIndex) const
+{
+	return d->groups.at(groupIndex).parent;
+}
+
+FlatSetup::Range FlatSetup::groupEntries(int groupIndex) const
+{
+	return d->groups.at(groupIndex).children;
+}
+
+const Entry &FlatSetup::entry(int index) const
+{
+	return d->entries.at(index).element;
+}
+
+int FlatSetup::entryGroup(int entryIndex) const
+{
+	return d->entries.at(entryIndex).parent;
+}
+
+Setup FlatSetup::toSetup() const
+{
+	Setup setup;
+	setup.allowSearch = d->allowSearch;
+	setup.allowRestore = d->allowRestore;
+	setup.categories.reserve(d->categories.size());
+	for(const auto &categoryNode : d->categories) {
+		auto category = categoryNode.element;
+		category.sections.reserve(categoryNode.children.size());
+		for(auto sIndex = categoryNode.children.begin; sIndex < categoryNode.children.end; ++sIndex) {
+			const auto &sectionNode = d->sections[sIndex];
+			auto section = sectionNode.element;
+			section.groups.reserve(sectionNode.children.size());
+			for(auto gIndex = sectionNode.children.begin; gIndex < sectionNode.children.end; ++gIndex) {
+				const auto &groupNode = d->groups[gIndex];
+				auto group = groupNode.element;
+				group.entries.reserve(groupNode.children.size());
+				for(auto eIndex = groupNode.children.begin; eIndex < groupNode.children.end; ++eIndex)
+					group.entries.append(d->entries[eIndex].element);
+				section.groups.append(std::move(group));
+			}
+			category.sections.append(std::move(section));
+		}
+		setup.categories.append(std::move(category));
+	}
+	return setup;
+}
+
+// ------------- Private Implementation -------------
+
+void FlatSetupData::build(const Setup &setup)
+{
+	allowSearch = setup.allowSearch;
+	allowRestore = setup.allowRestore;
+
+	// count first, so every array is allocated exactly once
+	auto sectionCount = 0;
+	auto groupCount = 0;
+	auto entryCount = 0;
+	for(const auto &category : setup.categories) {
+		sectionCount += category.sections.size();
+		for(const auto &section : category.sections) {
+			groupCount += section.groups.size();
+			for(const auto &group : section.groups)
+				entryCount += group.entries.size();
+		}
+	}
+	categories.reserve(setup.categories.size());
+	sections.reserve(sectionCount);
+	groups.reserve(groupCount);
+	entries.reserve(entryCount);
+
+	for(const auto &category : setup.categories) {
+		Node<Category> categoryNode;
+		categoryNode.element = {category.title, category.icon, category.tooltip, {}, category.frontends, category.selectors};
+		intern(categoryNode.element.title);
+		intern(categoryNode.element.tooltip);
+		intern(categoryNode.element.frontends);
+		intern(categoryNode.element.selectors);
+		categoryNode.children.begin = sections.size();
+
+		for(const auto &section : category.sections) {
+			Node<Section> sectionNode;
+			sectionNode.element = {section.title, section.icon, section.tooltip, {}, section.frontends, section.selectors};
+			intern(sectionNode.element.title);
+			intern(sectionNode.element.tooltip);
+			intern(sectionNode.element.frontends);
+			intern(sectionNode.element.selectors);
+			sectionNode.parent = categories.size();
+			sectionNode.children.begin = groups.size();
+
+			for(const auto &group : section.groups) {
+				Node<Group> groupNode;
+				groupNode.element = {group.title, group.tooltip, {}, group.frontends, group.selectors};
+				intern(groupNode.element.title);
+				intern(groupNode.element.tooltip);
+				intern(groupNode.element.frontends);
+				intern(groupNode.element.selectors);
+				groupNode.parent = sections.size();
+				groupNode.children.begin = entries.size();
+
+				for(const auto &entry : group.entries) {
+					Node<Entry> entryNode;
+					entryNode.element = entry;
+					intern(entryNode.element.key);
+					intern(entryNode.element.title);
+					intern(entryNode.element.tooltip);
+					intern(entryNode.element.searchKeys);
+					intern(entryNode.element.frontends);
+					intern(entryNode.element.selectors);
+					entryNode.parent = groups.size();
+					entries.append(std::move(entryNode));
+				}
+
+				groupNode.children.end = entries.size();
+				groups.append(std::move(groupNode));
+			}
+
+			sectionNode.children.end = groups.size();
+			sections.append(std::move(sectionNode));
+		}
+
+		categoryNode.children.end = sections.size();
+		categories.append(std::move(categoryNode));
+	}
+
+	_stringPool.clear();
+	_stringPool.squeeze();
+}
+
+void FlatSetupData::intern(QString &string)
+{
+	if(string.isNull())
+		return;
+	auto it = _stringPool.constFind(string);
+	if(it == _stringPool.constEnd())
+		it = _stringPool.insert(string);
+	string = *it;
+}
+
+void FlatSetupData::intern(QStringList &strings)
+{
+	for(auto &string : strings)
+		intern(string);
+}
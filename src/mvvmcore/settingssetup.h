@@ -6,6 +6,7 @@
 #include <QtCore/qurl.h>
 #include <QtCore/qobject.h>
 #include <QtCore/qfileselector.h>
+#include <QtCore/qshareddata.h>
 
 #include "QtMvvmCore/qtmvvmcore_global.h"
 #include "QtMvvmCore/exception.h"
@@ -106,6 +107,83 @@ struct Setup
 	QList<Category> categories;
 };
 
+class FlatSetupData;
+//! An immutable, flat and implicitly shared representation of a Setup
+class Q_MVVMCORE_EXPORT FlatSetup
+{
+public:
+	//! A half open range of element indexes, i.e. `[begin, end)`
+	struct Range
+	{
+		//! The first index of the range
+		int begin = 0;
+		//! The index after the last element of the range
+		int end = 0;
+
+		//! Returns the number of elements in the range
+		inline int size() const { return end - begin; }
+	};
+
+	//! Default constructor, creates an empty setup
+	FlatSetup();
+	//! Creates a flat setup from the given nested setup
+	explicit FlatSetup(const Setup &setup);
+	//! Copy constructor
+	FlatSetup(const FlatSetup &other);
+	//! Move constructor
+	FlatSetup(FlatSetup &&other) noexcept;
+	~FlatSetup();
+
+	//! Copy assignment operator
+	FlatSetup &operator=(const FlatSetup &other);
+	//! Move assignment operator
+	FlatSetup &operator=(FlatSetup &&other) noexcept;
+
+	//! @copydoc Setup::allowSearch
+	bool allowSearch() const;
+	//! @copydoc Setup::allowRestore
+	bool allowRestore() const;
+
+	//! Returns the number of all categories in the setup
+	int categoryCount() const;
+	//! Returns the number of all sections in the setup
+	int sectionCount() const;
+	//! Returns the number of all groups in the setup
+	int groupCount() const;
+	//! Returns the number of all entries in the setup
+	int entryCount() const;
+
+	//! Returns the category at the given index, without its sections
+	const Category &category(int index) const;
+	//! Returns the indexes of the sections of the given category
+	Range categorySections(int categoryIndex) const;
+
+	//! Returns the section at the given index, without its groups
+	const Section &section(int index) const;
+	//! Returns the index of the category the given section belongs to
+	int sectionCategory(int sectionIndex) const;
+	//! Returns the indexes of the groups of the given section
+	Range sectionGroups(int sectionIndex) const;
+
+	//! Returns the group at the given index, without its entries
+	const Group &group(int index) const;
+	//! Returns the index of the section the given group belongs to
+	int groupSection(int groupIndex) const;
+	//! Returns the indexes of the entries of the given group
+	Range groupEntries(int groupIndex) const;
+
+	//! Returns the entry at the given index
+	const Entry &entry(int index) const;
+	//! Returns the index of the group the given entry belongs to
+	int entryGroup(int entryIndex) const;
+
+	//! Creates a nested setup from the flat one
+	Setup toSetup() const;
+
+private:
+	QSharedDataPointer<FlatSetupData> d;
+};
+
 }
 
 //! An exception throw in case loading a settings setup went wrong
@@ -132,6 +210,7 @@ Q_DECLARE_METATYPE(QtMvvm::SettingsElements::Group)
 Q_DECLARE_METATYPE(QtMvvm::SettingsElements::Section)
 Q_DECLARE_METATYPE(QtMvvm::SettingsElements::Category)
 Q_DECLARE_METATYPE(QtMvvm::SettingsElements::Setup)
+Q_DECLARE_METATYPE(QtMvvm::SettingsElements::FlatSetup)
 
 //! The Iid of the QtMvvm::ISettingsSetupLoader class
 #define QtMvvm_ISettingsSetupLoaderIid "de.skycoder42.qtmvvm.settings.core.ISettingsSetupLoader"
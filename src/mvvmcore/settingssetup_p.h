@@ -0,0 +1,44 @@
+#ifndef QTMVVM_SETTINGSSETUP_P_H
+#define QTMVVM_SETTINGSSETUP_P_H
+
+#include <QtCore/QVector>
+#include <QtCore/QSet>
+
+#include "qtmvvmcore_global.h"
+#include "settingssetup.h"
+
+namespace QtMvvm {
+namespace SettingsElements {
+
+class FlatSetupData : public QSharedData
+{
+public:
+	template <typename T>
+	struct Node {
+		T element;
+		int parent = -1;
+		FlatSetup::Range children;
+	};
+
+	bool allowSearch = true;
+	bool allowRestore = true;
+
+	QVector<Node<Category>> categories;
+	QVector<Node<Section>> sections;
+	QVector<Node<Group>> groups;
+	QVector<Node<Entry>> entries;
+
+	void build(const Setup &setup);
+
+private:
+	// only used while building, so equal strings share one allocation
+	QSet<QString> _stringPool;
+
+	void intern(QString &string);
+	void intern(QStringList &strings);
+};
+
+}
+}
+
+#endif // QTMVVM_SETTINGSSETUP_P_H
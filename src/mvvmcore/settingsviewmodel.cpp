@@ -3,6 +3,7 @@
 #include "coreapp.h"
 #include "qtmvvm_logging_p.h"
 #include "qsettingsaccessor.h"
+#include "settingsconfigloader_p.h"
 
 using namespace QtMvvm;
 
@@ -68,6 +69,22 @@ SettingsElements::Setup SettingsViewModel::loadSetup(const QString &frontend) co
 	}
 }
 
+SettingsElements::FlatSetup SettingsViewModel::loadFlatSetup(const QString &frontend) const
+{
+	try {
+		QFileSelector selector;
+		// the default loader caches the flat setup, so all views share the same instance
+		auto configLoader = dynamic_cast<SettingsConfigLoader*>(d->setupLoader);
+		if(configLoader)
+			return configLoader->loadFlatSetup(d->setupFile, frontend, &selector);
+		else
+			return SettingsElements::FlatSetup{d->setupLoader->loadSetup(d->setupFile, frontend, &selector)};
+	} catch(SettingsLoaderException &e) {
+		logCritical() << "Failed to load settings setup:" << e.what();
+		return {};
+	}
+}
+
 QSettings *SettingsViewModel::settings() const
 {
 	auto qAccessor = qobject_cast<QSettingsAccessor*>(d->accessor);
@@ -90,6 +107,11 @@ void SettingsViewModel::resetValue(const QString &key)
 }
 
 void SettingsViewModel::resetAll(const SettingsElements::Setup &setup)
+{
+	resetAll(SettingsElements::FlatSetup{setup});
+}
+
+void SettingsViewModel::resetAll(const SettingsElements::FlatSetup &setup)
 {
 	if(!canRestoreDefaults())
 		return;
@@ -98,15 +120,8 @@ void SettingsViewModel::resetAll(const SettingsElements::Setup &setup)
 	connect(result, &MessageResult::dialogDone, this, [this, setup](MessageConfig::StandardButton btn) {
 		if(btn != MessageConfig::Yes)
 			return;
-		for(const auto &category : setup.categories) {
-			for(const auto &section : category.sections) {
-				for(const auto &group : section.groups) {
-					for(const auto &entry : group.entries) {
-						resetValue(entry.key);
-					}
-				}
-			}
-		}
+		for(auto i = 0; i < setup.entryCount(); i++)
+			resetValue(setup.entry(i).key);
 		emit resetAccepted({});
 	}, Qt::QueuedConnection);
 }
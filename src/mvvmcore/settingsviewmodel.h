@@ -59,6 +59,8 @@ public:
 
 	//! Loads the settings setup of the prepared file for the given frontend
 	SettingsElements::Setup loadSetup(const QString &frontend) const;
+	//! Loads the settings setup of the prepared file for the given frontend as shared flat setup
+	SettingsElements::FlatSetup loadFlatSetup(const QString &frontend) const;
 
 	//! Returns the settings this viewmodel operates on (or null if not using QtMvvm::QSettingsAccessor)
 	QSettings *settings() const;
@@ -71,6 +73,8 @@ public:
 	Q_INVOKABLE virtual void resetValue(const QString &key);
 	//! Resets all values that are defined by the entries in the given setup
 	QTMVVM_REVISION_1 Q_INVOKABLE void resetAll(const SettingsElements::Setup &setup);
+	//! @copybrief SettingsViewModel::resetAll(const SettingsElements::Setup &)
+	void resetAll(const SettingsElements::FlatSetup &setup);
 
 public Q_SLOTS:
 	//! Is called when an action type edit is pressed
@@ -0,0 +1,369 @@
+#include "snapshotsettingsaccessor.h"
+#include "qsettingsaccessor.h"
+#include <QtCore/QThread>
+#include <QtCore/QMutex>
+#include <QtCore/QVector>
+#include <atomic>
+using namespace QtMvvm;
+
+namespace QtMvvm {
+
+class SnapshotSettingsAccessorPrivate
+{
+	Q_DISABLE_COPY(SnapshotSettingsAccessorPrivate)
+
+public:
+	struct Snapshot {
+		QVariantHash values;
+		quint64 version = 0;
+	};
+
+	// keeps the current snapshot alive while it is read, without locking
+	class ReadGuard
+	{
+		Q_DISABLE_COPY(ReadGuard)
+
+	public:
+		inline explicit ReadGuard(SnapshotSettingsAccessorPrivate *d) :
+			_d{d},
+			_slot{d->enterRead()},
+			_snapshot{d->snapshot.load(std::memory_order_seq_cst)}
+		{}
+		inline ~ReadGuard() {
+			_d->leaveRead(_slot);
+		}
+
+		inline const Snapshot *operator->() const {
+			return _snapshot;
+		}
+
+	private:
+		SnapshotSettingsAccessorPrivate *_d;
+		int _slot;
+		const Snapshot *_snapshot;
+	};
+
+	SnapshotSettingsAccessorPrivate(ISettingsAccessor *accessor);
+	~SnapshotSettingsAccessorPrivate();
+
+	ISettingsAccessor *accessor;
+	// replaced by writers only, while holding the writeMutex
+	std::atomic<const Snapshot*> snapshot;
+	// advanced by writers only, while holding the writeMutex
+	std::atomic<quint64> epoch{0};
+	// the number of ReadGuards that started in an even or odd epoch
+	std::atomic<int> readers[2] {{0}, {0}};
+	// serializes writers and reclaiming, readers only try to lock it
+	QMutex writeMutex;
+	// snapshots replaced in the current epoch
+	QVector<const Snapshot*> retired;
+	// snapshots replaced in the previous epoch, deleted once its readers are done
+	QVector<const Snapshot*> expired;
+	// set while there are retired or expired snapshots
+	std::atomic<bool> reclaimPending{false};
+
+	int enterRead();
+	void leaveRead(int slot);
+
+	// may only be used by writers
+	const Snapshot *current() const;
+	void publish(QVariantHash values);
+	void reclaim();
+	void tryReclaim();
+	void insert(const QString &key, const QVariant &value);
+	void remove(const QString &key, bool recursive);
+	QVariantHash readAll() const;
+
+	template <typename T>
+	T loadTyped(const SnapshotSettingsAccessor *q, const QString &key, const T &defaultValue);
+};
+
+}
+
+SnapshotSettingsAccessor::SnapshotSettingsAccessor(QObject *parent) :
+	SnapshotSettingsAccessor{new QSettingsAccessor{}, parent}
+{}
+
+SnapshotSettingsAccessor::SnapshotSettingsAccessor(ISettingsAccessor *accessor, QObject *parent) :
+	ISettingsAccessor{parent},
+	d{new SnapshotSettingsAccessorPrivate{accessor}}
+{
+	d->accessor->setParent(this);
+	connect(d->accessor, &ISettingsAccessor::entryChanged,
+			this, &SnapshotSettingsAccessor::accessorEntryChanged);
+	connect(d->accessor, &ISettingsAccessor::entryRemoved,
+			this, &SnapshotSettingsAccessor::accessorEntryRemoved);
+	d->publish(d->readAll());
+}
+
+SnapshotSettingsAccessor::~SnapshotSettingsAccessor() = default;
+
+bool SnapshotSettingsAccessor::contains(const QString &key) const
+{
+	{
+		SnapshotSettingsAccessorPrivate::ReadGuard snapshot{d.data()};
+		if(snapshot->values.contains(key))
+			return true;
+	}
+	// keys the wrapped accessor could not enumerate are only looked up on the owning thread
+	if(QThread::currentThread() == thread() && d->accessor->contains(key)) {
+		d->insert(key, d->accessor->load(key));
+		return true;
+	} else
+		return false;
+}
+
+QVariant SnapshotSettingsAccessor::load(const QString &key, const QVariant &defaultValue) const
+{
+	{
+		SnapshotSettingsAccessorPrivate::ReadGuard snapshot{d.data()};
+		auto it = snapshot->values.constFind(key);
+		if(it != snapshot->values.constEnd())
+			return *it;
+	}
+	if(contains(key)) {
+		SnapshotSettingsAccessorPrivate::ReadGuard snapshot{d.data()};
+		return snapshot->values.value(key, defaultValue);
+	} else
+		return defaultValue;
+}
+
+bool SnapshotSettingsAccessor::loadBool(const QString &key, bool defaultValue) const
+{
+	return d->loadTyped(this, key, defaultValue);
+}
+
+int SnapshotSettingsAccessor::loadInt(const QString &key, int defaultValue) const
+{
+	return d->loadTyped(this, key, defaultValue);
+}
+
+qint64 SnapshotSettingsAccessor::loadInt64(const QString &key, qint64 defaultValue) const
+{
+	return d->loadTyped(this, key, defaultValue);
+}
+
+double SnapshotSettingsAccessor::loadDouble(const QString &key, double defaultValue) const
+{
+	return d->loadTyped(this, key, defaultValue);
+}
+
+QString SnapshotSettingsAccessor::loadString(const QString &key, const QString &defaultValue) const
+{
+	return d->loadTyped(this, key, defaultValue);
+}
+
+QByteArray SnapshotSettingsAccessor::loadByteArray(const QString &key, const QByteArray &defaultValue) const
+{
+	return d->loadTyped(this, key, defaultValue);
+}
+
+void SnapshotSettingsAccessor::save(const QString &key, const QVariant &value)
+{
+	d->insert(key, value);
+	// change signals are forwarded from the wrapped accessor
+	d->accessor->save(key, value);
+}
+
+void SnapshotSettingsAccessor::remove(const QString &key)
+{
+	d->remove(key, true);
+	d->accessor->remove(key);
+}
+
+ISettingsAccessor *SnapshotSettingsAccessor::accessor() const
+{
+	return d->accessor;
+}
+
+QVariantHash SnapshotSettingsAccessor::snapshot() const
+{
+	SnapshotSettingsAccessorPrivate::ReadGuard snapshot{d.data()};
+	return snapshot->values;
+}
+
+quint64 SnapshotSettingsAccessor::version() const
+{
+	SnapshotSettingsAccessorPrivate::ReadGuard snapshot{d.data()};
+	return snapshot->version;
+}
+
+void SnapshotSettingsAccessor::sync()
+{
+	d->accessor->sync();
+	refresh();
+}
+
+void SnapshotSettingsAccessor::refresh()
+{
+	{
+		QMutexLocker lock{&d->writeMutex};
+		d->publish(d->readAll());
+	}
+	d->tryReclaim();
+}
+
+void SnapshotSettingsAccessor::accessorEntryChanged(const QString &key, const QVariant &value)
+{
+	d->insert(key, value);
+	emit entryChanged(key, value);
+}
+
+void SnapshotSettingsAccessor::accessorEntryRemoved(const QString &key)
+{
+	d->remove(key, false);
+	emit entryRemoved(key);
+}
+
+// ------------- Private Implementation -------------
+
+SnapshotSettingsAccessorPrivate::SnapshotSettingsAccessorPrivate(ISettingsAccessor *accessor) :
+	accessor{accessor},
+	snapshot{new Snapshot{}}
+{}
+
+SnapshotSettingsAccessorPrivate::~SnapshotSettingsAccessorPrivate()
+{
+	qDeleteAll(retired);
+	qDeleteAll(expired);
+	delete snapshot.load(std::memory_order_acquire);
+}
+
+int SnapshotSettingsAccessorPrivate::enterRead()
+{
+	forever {
+		const auto current = epoch.load(std::memory_order_seq_cst);
+		const auto slot = static_cast<int>(current & 1);
+		readers[slot].fetch_add(1, std::memory_order_seq_cst);
+		// a writer that advanced the epoch in between does not wait for this slot anymore
+		if(epoch.load(std::memory_order_seq_cst) == current)
+			return slot;
+		leaveRead(slot);
+	}
+}
+
+void SnapshotSettingsAccessorPrivate::leaveRead(int slot)
+{
+	// the last reader of a slot frees what the writers had to leave behind
+	if(readers[slot].fetch_sub(1, std::memory_order_seq_cst) == 1 &&
+	   reclaimPending.load(std::memory_order_seq_cst))
+		tryReclaim();
+}
+
+const SnapshotSettingsAccessorPrivate::Snapshot *SnapshotSettingsAccessorPrivate::current() const
+{
+	// only writers replace the snapshot, so it cannot be deleted while they use it
+	return snapshot.load(std::memory_order_acquire);
+}
+
+void SnapshotSettingsAccessorPrivate::publish(QVariantHash values)
+{
+	auto next = new Snapshot{};
+	next->values = std::move(values);
+	next->version = current()->version + 1;
+	retired.append(snapshot.exchange(next, std::memory_order_seq_cst));
+	reclaim();
+}
+
+void SnapshotSettingsAccessorPrivate::reclaim()
+{
+	const auto current = epoch.load(std::memory_order_relaxed);
+	// readers that started before the current epoch may still use any of the replaced snapshots.
+	// No reader can start in the previous epoch anymore, so its slot only drains
+	if(readers[(current - 1) & 1].load(std::memory_order_seq_cst) == 0) {
+		qDeleteAll(expired);
+		expired.clear();
+		if(!retired.isEmpty()) {
+			// readers starting from now on can only see the current snapshot
+			epoch.store(current + 1, std::memory_order_seq_cst);
+			expired.swap(retired);
+			if(readers[current & 1].load(std::memory_order_seq_cst) == 0) {
+				qDeleteAll(expired);
+				expired.clear();
+			}
+		}
+	}
+	reclaimPending.store(!retired.isEmpty() || !expired.isEmpty(), std::memory_order_seq_cst);
+}
+
+void SnapshotSettingsAccessorPrivate::tryReclaim()
+{
+	// readers must never block. If a writer holds the lock, it tries again once it released it
+	if(!reclaimPending.load(std::memory_order_seq_cst) || !writeMutex.tryLock())
+		return;
+	reclaim();
+	writeMutex.unlock();
+}
+
+void SnapshotSettingsAccessorPrivate::insert(const QString &key, const QVariant &value)
+{
+	{
+		QMutexLocker lock{&writeMutex};
+		const auto snapshot = current();
+		auto it = snapshot->values.constFind(key);
+		if(it != snapshot->values.constEnd() && *it == value)
+			return;
+		auto values = snapshot->values;
+		values.insert(key, value);
+		publish(std::move(values));
+	}
+	tryReclaim();
+}
+
+void SnapshotSettingsAccessorPrivate::remove(const QString &key, bool recursive)
+{
+	{
+		QMutexLocker lock{&writeMutex};
+		auto values = current()->values;
+		auto removed = values.remove(key) > 0;
+		if(recursive) {
+			const auto prefix = key + QLatin1Char('/');
+			for(auto it = values.begin(); it != values.end();) {
+				if(it.key().startsWith(prefix)) {
+					it = values.erase(it);
+					removed = true;
+				} else
+					++it;
+			}
+		}
+		if(removed)
+			publish(std::move(values));
+	}
+	tryReclaim();
+}
+
+QVariantHash SnapshotSettingsAccessorPrivate::readAll() const
+{
+	QVariantHash values;
+	auto qAccessor = qobject_cast<QSettingsAccessor*>(accessor);
+	if(qAccessor) {
+		auto settings = qAccessor->settings();
+		for(const auto &key : settings->allKeys())
+			values.insert(key, settings->value(key));
+	} else {
+		// other accessors cannot enumerate their keys, so only the known ones are reloaded
+		const auto known = current()->values;
+		for(auto it = known.constBegin(); it != known.constEnd(); ++it) {
+			if(accessor->contains(it.key()))
+				values.insert(it.key(), accessor->load(it.key()));
+		}
+	}
+	return values;
+}
+
+template <typename T>
+T SnapshotSettingsAccessorPrivate::loadTyped(const SnapshotSettingsAccessor *q, const QString &key, const T &defaultValue)
+{
+	{
+		ReadGuard snapshot{this};
+		auto it = snapshot->values.constFind(key);
+		// converts the stored value in place, without copying it or boxing the default
+		if(it != snapshot->values.constEnd())
+			return it->template value<T>();
+	}
+	if(!q->contains(key))
+		return defaultValue;
+	ReadGuard snapshot{this};
+	auto it = snapshot->values.constFind(key);
+	return it != snapshot->values.constEnd() ? it->template value<T>() : defaultValue;
+}
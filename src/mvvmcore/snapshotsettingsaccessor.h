@@ -0,0 +1,62 @@
+#ifndef QTMVVM_SNAPSHOTSETTINGSACCESSOR_H
+#define QTMVVM_SNAPSHOTSETTINGSACCESSOR_H
+
+#include <QtCore/qscopedpointer.h>
+
+#include "QtMvvmCore/qtmvvmcore_global.h"
+#include "QtMvvmCore/isettingsaccessor.h"
+
+namespace QtMvvm {
+
+class SnapshotSettingsAccessorPrivate;
+//! A settings accessor that serves reads from an immutable snapshot, safe for all threads
+class Q_MVVMCORE_EXPORT SnapshotSettingsAccessor : public ISettingsAccessor
+{
+	Q_OBJECT
+	Q_INTERFACES(QtMvvm::ISettingsAccessor)
+
+public:
+	//! Default Constructor, wraps a QSettingsAccessor
+	Q_INVOKABLE explicit SnapshotSettingsAccessor(QObject *parent = nullptr);
+	//! Constructor, with the accessor to be wrapped (takes ownership of the accessor)
+	explicit SnapshotSettingsAccessor(ISettingsAccessor *accessor, QObject *parent = nullptr);
+	~SnapshotSettingsAccessor() override;
+
+	bool contains(const QString &key) const override;
+	QVariant load(const QString &key, const QVariant &defaultValue = {}) const override;
+	void save(const QString &key, const QVariant &value) override;
+	void remove(const QString &key) override;
+
+	bool loadBool(const QString &key, bool defaultValue = false) const override;
+	int loadInt(const QString &key, int defaultValue = 0) const override;
+	qint64 loadInt64(const QString &key, qint64 defaultValue = 0) const override;
+	double loadDouble(const QString &key, double defaultValue = 0.0) const override;
+	QString loadString(const QString &key, const QString &defaultValue = {}) const override;
+	QByteArray loadByteArray(const QString &key, const QByteArray &defaultValue = {}) const override;
+
+	//! Returns the wrapped accessor
+	ISettingsAccessor *accessor() const;
+	//! Returns the current snapshot of all known keys and their values
+	QVariantHash snapshot() const;
+	//! Returns the version of the current snapshot. Is increased with every published snapshot
+	quint64 version() const;
+
+public Q_SLOTS:
+	//! @copydoc ISettingsAccessor::sync
+	void sync() override;
+	//! Reloads all known values from the wrapped accessor and publishes them as a new snapshot
+	void refresh();
+
+private Q_SLOTS:
+	void accessorEntryChanged(const QString &key, const QVariant &value);
+	void accessorEntryRemoved(const QString &key);
+
+private:
+	QScopedPointer<SnapshotSettingsAccessorPrivate> d;
+};
+
+}
+
+Q_DECLARE_METATYPE(QtMvvm::SnapshotSettingsAccessor*)
+
+#endif // QTMVVM_SNAPSHOTSETTINGSACCESSOR_H
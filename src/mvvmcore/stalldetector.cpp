@@ -0,0 +1,376 @@
+#include "stalldetector.h"
+#include "qtmvvm_logging_p.h"
+#include <QtCore/QCoreApplication>
+#include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QMutex>
+#include <QtCore/QTextStream>
+#include <QtCore/QThread>
+#include <QtCore/QWaitCondition>
+#include <atomic>
+#include <cstring>
+using namespace QtMvvm;
+
+namespace {
+
+const int MaxDepth = 32;
+const int DetailSize = 56;
+const int MaxReports = 32;
+
+struct ScopeSlot {
+	// odd while beeing written
+	std::atomic<quint32> sequence{0};
+	StallDetector::ScopeType type = StallDetector::InvalidScope;
+	qint64 start = 0;
+	char detail[DetailSize] = {};
+};
+
+class Watchdog;
+
+struct DetectorData {
+	DetectorData();
+
+	QElapsedTimer timer;
+	std::atomic<bool> running{false};
+	std::atomic<Qt::HANDLE> guiThread{nullptr};
+
+	// only written by the gui thread
+	std::atomic<int> depth{0};
+	ScopeSlot slots[MaxDepth];
+
+	std::atomic<bool> beatPending{false};
+	std::atomic<qint64> beatReceived{0};
+
+	QMutex mutex;
+	Watchdog *watchdog = nullptr;
+	int threshold = 200;
+	QString reportPath;
+	QVector<StallDetector::Report> reports;
+
+	QVector<StallDetector::ScopeInfo> captureScopes() const;
+	void addReport(const StallDetector::Report &report);
+};
+
+Q_GLOBAL_STATIC(DetectorData, detector)
+
+class Watchdog : public QThread
+{
+public:
+	Watchdog(DetectorData *data, int threshold);
+
+	void requestStop();
+
+protected:
+	void run() override;
+
+private:
+	DetectorData *_data;
+	const qint64 _threshold;
+	const unsigned long _interval;
+
+	QMutex _mutex;
+	QWaitCondition _condition;
+	bool _stop = false;
+
+	// waits for the interval and returns false if the watchdog was stopped
+	bool idle();
+};
+
+void writeReport(QTextStream &stream, const StallDetector::Report &report)
+{
+	stream << "GUI thread stalled for "
+		   << QString::number(report.duration / 1000000.0, 'f', 1) << " ms at "
+		   << QString::number(report.timestamp / 1000000.0, 'f', 3) << " ms\n";
+	if(report.scopes.isEmpty())
+		stream << "  (no QtMvvm scope active)\n";
+	auto indent = 1;
+	for(const auto &scope : report.scopes) {
+		stream << QString{indent * 2, QLatin1Char(' ')}
+			   << StallDetector::typeName(scope.type);
+		if(!scope.detail.isEmpty())
+			stream << "  " << QString::fromUtf8(scope.detail);
+		stream << "  (active for " << QString::number(scope.duration / 1000000.0, 'f', 1) << " ms)\n";
+		++indent;
+	}
+}
+
+}
+
+bool StallDetector::isRunning()
+{
+	auto data = detector();
+	return data && data->running.load(std::memory_order_relaxed);
+}
+
+void StallDetector::start(int thresholdMsecs)
+{
+	auto data = detector();
+	QMutexLocker lock{&data->mutex};
+	if(data->watchdog)
+		return;
+	if(!qApp) {
+		logWarning() << "Unable to start the stall detector without a QCoreApplication";
+		return;
+	}
+
+	if(QThread::currentThread() != qApp->thread()) {
+		logWarning() << "The stall detector must be started from the main thread";
+		return;
+	}
+
+	data->threshold = qMax(thresholdMsecs, 1);
+	data->guiThread.store(QThread::currentThreadId(), std::memory_order_relaxed);
+	data->beatPending.store(false);
+	data->watchdog = new Watchdog{data, data->threshold};
+	data->running.store(true, std::memory_order_relaxed);
+	data->watchdog->start(QThread::HighPriority);
+	// the watchdog must not outlive the application it sends heartbeats to
+	qAddPostRoutine(&StallDetector::stop);
+	logDebug() << "Started stall detector with a threshold of" << data->threshold << "ms";
+}
+
+void StallDetector::stop()
+{
+	auto data = detector();
+	if(!data)
+		return;
+	Watchdog *watchdog = nullptr;
+	{
+		QMutexLocker lock{&data->mutex};
+		watchdog = data->watchdog;
+		data->watchdog = nullptr;
+		data->running.store(false, std::memory_order_relaxed);
+	}
+	if(watchdog) {
+		qRemovePostRoutine(&StallDetector::stop);
+		// outside of the lock, as the watchdog reports a running stall before quitting
+		watchdog->requestStop();
+		watchdog->wait();
+		delete watchdog;
+		logDebug() << "Stopped stall detector";
+	}
+}
+
+int StallDetector::threshold()
+{
+	auto data = detector();
+	QMutexLocker lock{&data->mutex};
+	return data->threshold;
+}
+
+QVector<StallDetector::Report> StallDetector::reports()
+{
+	auto data = detector();
+	if(!data)
+		return {};
+	QMutexLocker lock{&data->mutex};
+	return data->reports;
+}
+
+void StallDetector::clearReports()
+{
+	auto data = detector();
+	QMutexLocker lock{&data->mutex};
+	data->reports.clear();
+}
+
+void StallDetector::setReportPath(const QString &filePath)
+{
+	auto data = detector();
+	QMutexLocker lock{&data->mutex};
+	data->reportPath = filePath;
+}
+
+bool StallDetector::dump(QIODevice *device)
+{
+	if(!device->isWritable())
+		return false;
+
+	const auto allReports = reports();
+	QTextStream stream{device};
+	stream << "QtMvvm stall detector: " << allReports.size() << " stalls, oldest first\n";
+	for(const auto &report : allReports)
+		writeReport(stream, report);
+	stream.flush();
+	return stream.status() == QTextStream::Ok;
+}
+
+bool StallDetector::dump(const QString &filePath)
+{
+	QFile file{filePath};
+	if(!file.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Truncate))
+		return false;
+	return dump(&file);
+}
+
+const char *StallDetector::typeName(ScopeType type)
+{
+	switch(type) {
+	case InvalidScope:
+		return "Invalid";
+	case ServiceConstruction:
+		return "ServiceConstruction";
+	case ShowViewModel:
+		return "ShowViewModel";
+	case ViewCreation:
+		return "ViewCreation";
+	case SettingsLoading:
+		return "SettingsLoading";
+	case BindingUpdate:
+		return "BindingUpdate";
+	default:
+		return type >= UserScope ? "UserScope" : "Unknown";
+	}
+}
+
+
+
+StallDetector::Scope::Scope(ScopeType type, const char *detail) noexcept :
+	_active{false}
+{
+	auto data = detector();
+	if(!data || !data->running.load(std::memory_order_relaxed) ||
+	   QThread::currentThreadId() != data->guiThread.load(std::memory_order_relaxed))
+		return;
+
+	const auto depth = data->depth.load(std::memory_order_relaxed);
+	if(depth < MaxDepth) {
+		auto &slot = data->slots[depth];
+		const auto sequence = slot.sequence.load(std::memory_order_relaxed);
+		slot.sequence.store(sequence + 1, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		slot.type = type;
+		slot.start = data->timer.nsecsElapsed();
+		if(detail)
+			qstrncpy(slot.detail, detail, DetailSize);
+		else
+			slot.detail[0] = '\0';
+		slot.sequence.store(sequence + 2, std::memory_order_release);
+	}
+	data->depth.store(depth + 1, std::memory_order_release);
+	_active = true;
+}
+
+StallDetector::Scope::~Scope()
+{
+	if(_active)
+		detector()->depth.fetch_sub(1, std::memory_order_release);
+}
+
+// ------------- Private Implementation -------------
+
+DetectorData::DetectorData()
+{
+	timer.start();
+}
+
+QVector<StallDetector::ScopeInfo> DetectorData::captureScopes() const
+{
+	QVector<StallDetector::ScopeInfo> scopes;
+	const auto count = qMin(depth.load(std::memory_order_acquire), MaxDepth);
+	const auto now = timer.nsecsElapsed();
+	scopes.reserve(count);
+	for(auto i = 0; i < count; ++i) {
+		const auto &slot = slots[i];
+		StallDetector::ScopeInfo info;
+		const auto before = slot.sequence.load(std::memory_order_acquire);
+		const auto type = slot.type;
+		const auto start = slot.start;
+		char detail[DetailSize];
+		std::memcpy(detail, slot.detail, DetailSize);
+		std::atomic_thread_fence(std::memory_order_acquire);
+		const auto after = slot.sequence.load(std::memory_order_relaxed);
+		// scopes that are currently entered are reported as invalid
+		if(before % 2 == 0 && after == before) {
+			detail[DetailSize - 1] = '\0';
+			info.type = type;
+			info.detail = QByteArray{detail};
+			info.duration = now - start;
+		}
+		scopes.append(info);
+	}
+	return scopes;
+}
+
+void DetectorData::addReport(const StallDetector::Report &report)
+{
+	QString text;
+	QTextStream stream{&text};
+	writeReport(stream, report);
+	stream.flush();
+	logWarning().noquote() << text.trimmed();
+
+	QMutexLocker lock{&mutex};
+	reports.append(report);
+	if(reports.size() > MaxReports)
+		reports.remove(0, reports.size() - MaxReports);
+	if(!reportPath.isEmpty()) {
+		QFile file{reportPath};
+		if(file.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Append))
+			file.write(text.toUtf8());
+		else
+			logWarning() << "Failed to write stall report to" << reportPath << "with error:" << file.errorString();
+	}
+}
+
+Watchdog::Watchdog(DetectorData *data, int threshold) :
+	_data{data},
+	_threshold{threshold * 1000000ll},
+	_interval{static_cast<unsigned long>(qBound(5, threshold / 4, 100))}
+{}
+
+void Watchdog::requestStop()
+{
+	QMutexLocker lock{&_mutex};
+	_stop = true;
+	_condition.wakeAll();
+}
+
+void Watchdog::run()
+{
+	auto running = true;
+	while(running) {
+		// send the heartbeat through the event loop of the gui thread
+		const auto posted = _data->timer.nsecsElapsed();
+		_data->beatPending.store(true, std::memory_order_release);
+		auto data = _data;
+		QMetaObject::invokeMethod(qApp, [data](){
+			data->beatReceived.store(data->timer.nsecsElapsed(), std::memory_order_relaxed);
+			data->beatPending.store(false, std::memory_order_release);
+		}, Qt::QueuedConnection);
+
+		auto stalled = false;
+		StallDetector::Report report;
+		report.timestamp = posted;
+		while(_data->beatPending.load(std::memory_order_acquire)) {
+			running = idle();
+			if(!running)
+				break;
+			if(_data->timer.nsecsElapsed() - posted >= _threshold) {
+				// scopes entered later in the stall are still better than none
+				if(report.scopes.isEmpty())
+					report.scopes = _data->captureScopes();
+				stalled = true;
+			}
+		}
+
+		if(stalled) {
+			if(_data->beatPending.load(std::memory_order_acquire))
+				report.duration = _data->timer.nsecsElapsed() - posted;
+			else
+				report.duration = _data->beatReceived.load(std::memory_order_relaxed) - posted;
+			_data->addReport(report);
+		}
+
+		if(running)
+			running = idle();
+	}
+}
+
+bool Watchdog::idle()
+{
+	QMutexLocker lock{&_mutex};
+	if(!_stop)
+		_condition.wait(&_mutex, _interval);
+	return !_stop;
+}
@@ -0,0 +1,104 @@
+#ifndef QTMVVM_STALLDETECTOR_H
+#define QTMVVM_STALLDETECTOR_H
+
+#include <QtCore/qglobal.h>
+#include <QtCore/qvector.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qbytearray.h>
+
+#include "QtMvvmCore/qtmvvmcore_global.h"
+
+QT_BEGIN_NAMESPACE
+class QIODevice;
+QT_END_NAMESPACE
+
+namespace QtMvvm {
+
+//! A watchdog that detects stalls of the GUI thread and attributes them to QtMvvm operations
+class Q_MVVMCORE_EXPORT StallDetector
+{
+	Q_DISABLE_COPY(StallDetector)
+
+public:
+	//! The kinds of operations that are tracked as scopes
+	enum ScopeType : quint8 {
+		InvalidScope = 0, //!< Marks a scope that could not be read
+		ServiceConstruction, //!< A service is constructed by the ServiceRegistry. The detail is the iid
+		ShowViewModel, //!< A viewmodel is shown by the CoreApp. The detail is the viewmodel class
+		ViewCreation, //!< A presenter creates and presents a view. The detail is the viewmodel class
+		SettingsLoading, //!< A settings configuration file is loaded. The detail is the file path
+		BindingUpdate, //!< A Binding transfers a value. The detail is the property written to
+
+		UserScope = 0x80 //!< The first value that can be used for custom scopes
+	};
+
+	//! An RAII marker for an operation on the GUI thread
+	class Q_MVVMCORE_EXPORT Scope
+	{
+		Q_DISABLE_COPY(Scope)
+
+	public:
+		//! Enters a scope. The detail is copied and truncated to a few dozen characters
+		explicit Scope(ScopeType type, const char *detail = nullptr) noexcept;
+		//! Leaves the scope
+		~Scope();
+
+	private:
+		bool _active;
+	};
+
+	//! A scope that was active while the GUI thread stalled
+	struct ScopeInfo {
+		//! The type of the scope
+		ScopeType type = InvalidScope;
+		//! The detail passed to the scope
+		QByteArray detail;
+		//! The nanoseconds the scope had been active when the stall was detected
+		qint64 duration = 0;
+	};
+
+	//! A detected stall of the GUI thread
+	struct Report {
+		//! The nanoseconds since the detector was first started, when the stall began
+		qint64 timestamp = 0;
+		//! The nanoseconds the GUI thread did not process events
+		qint64 duration = 0;
+		//! The active scopes, outermost first
+		QVector<ScopeInfo> scopes;
+	};
+
+	//! Returns true if the watchdog is running
+	static bool isRunning();
+	//! Starts the watchdog for the thread of the application. Stalls longer than threshold are reported
+	static void start(int thresholdMsecs = 200);
+	//! Stops the watchdog
+	static void stop();
+	//! Returns the threshold in milliseconds
+	static int threshold();
+
+	//! Returns the most recent reports, oldest first
+	static QVector<Report> reports();
+	//! Removes all reports
+	static void clearReports();
+	//! Sets a file every report is appended to. Pass an empty path to only log reports
+	static void setReportPath(const QString &filePath);
+
+	//! Writes the reports as human readable text to the device
+	static bool dump(QIODevice *device);
+	//! Writes the reports as human readable text to the given file
+	static bool dump(const QString &filePath);
+
+	//! Returns a readable name for a scope type
+	static const char *typeName(ScopeType type);
+
+private:
+	StallDetector() = delete;
+};
+
+}
+
+Q_DECLARE_TYPEINFO(QtMvvm::StallDetector::ScopeInfo, Q_MOVABLE_TYPE);
+Q_DECLARE_TYPEINFO(QtMvvm::StallDetector::Report, Q_MOVABLE_TYPE);
+
+//! @file stalldetector.h The StallDetector class header
+#endif // QTMVVM_STALLDETECTOR_H
@@ -1,15 +1,23 @@
 #include "viewmodel.h"
 #include "viewmodel_p.h"
 #include "coreapp_p.h"
+#include "flightrecorder.h"
+#include "viewmodeltracker_p.h"
+#include <QtCore/QDateTime>
 #include "qtmvvm_logging_p.h"
 using namespace QtMvvm;
 
 ViewModel::ViewModel(QObject *parent) :
 	QObject(parent),
 	d(new ViewModelPrivate())
-{}
+{
+	ViewModelTrackerPrivate::add(this);
+}
 
-ViewModel::~ViewModel() = default;
+ViewModel::~ViewModel()
+{
+	ViewModelTrackerPrivate::remove(this);
+}
 
 void ViewModel::onInit(const QVariantHash &) {}
 
@@ -66,9 +74,25 @@ void ViewModel::showForResult(quint32 requestCode, const QMetaObject *viewMetaOb
 
 void ViewModel::showImp(const QMetaObject *metaObject, const QVariantHash &params, QPointer<ViewModel> parent, quint32 requestCode)
 {
+	FlightRecorder::record(FlightRecorder::ShowRequested, metaObject, requestCode);
 	QMetaObject::invokeMethod(CoreAppPrivate::dInstance().data(), "showViewModel", Qt::QueuedConnection,
 							  Q_ARG(const QMetaObject*, metaObject),
 							  Q_ARG(QVariantHash, params),
 							  Q_ARG(QPointer<ViewModel>, parent),
 							  Q_ARG(quint32, requestCode));
 }
+
+void ViewModel::showImp(const QMetaObject *metaObject, std::function<void(ViewModel*)> typedInit, QPointer<ViewModel> parent, quint32 requestCode)
+{
+	FlightRecorder::record(FlightRecorder::ShowRequested, metaObject, requestCode);
+	auto d = CoreAppPrivate::dInstance().data();
+	QMetaObject::invokeMethod(d, [d, metaObject, typedInit{std::move(typedInit)}, parent, requestCode]() {
+		d->showViewModelWithReturn(metaObject, {}, parent, requestCode, typedInit);
+	}, Qt::QueuedConnection);
+}
+
+// ------------- Private Implementation -------------
+
+ViewModelPrivate::ViewModelPrivate() :
+	created{QDateTime::currentMSecsSinceEpoch()}
+{}
@@ -2,11 +2,13 @@
 #define QTMVVM_VIEWMODEL_H
 
 #include <type_traits>
+#include <functional>
 
 #include <QtCore/qobject.h>
 #include <QtCore/qscopedpointer.h>
 #include <QtCore/qvariant.h>
 #include <QtCore/qpointer.h>
+#include <QtCore/qsharedpointer.h>
 
 #include "QtMvvmCore/qtmvvmcore_global.h"
 #include "QtMvvmCore/injection.h"
@@ -15,6 +17,7 @@ namespace QtMvvm {
 
 class CoreApp;
 class CoreAppPrivate;
+class ViewModelTrackerPrivate;
 
 class ViewModelPrivate;
 //! The base class for all viewmodels
@@ -44,6 +47,9 @@ protected:
 	//! Show another viewmodel as a child of this one
 	template <typename TViewModel>
 	inline void show(const QVariantHash &params = {}) const;
+	//! Show another viewmodel as a child of this one and move the typed parameters to it
+	template <typename TViewModel, typename TParams, typename = std::enable_if_t<!std::is_same<std::decay_t<TParams>, QVariantHash>::value>>
+	inline void show(TParams &&params) const;
 	//! @copybrief ViewModel::show(const QVariantHash &) const
 	void show(const char *viewModelName, const QVariantHash &params = {}) const;
 	//! @copybrief ViewModel::show(const QVariantHash &) const
@@ -51,6 +57,9 @@ protected:
 	//! Show another viewmodel as a child of this one and expect its result
 	template <typename TViewModel>
 	inline void showForResult(quint32 requestCode, const QVariantHash &params = {}) const;
+	//! Show another viewmodel as a child of this one, move the typed parameters to it and expect its result
+	template <typename TViewModel, typename TParams, typename = std::enable_if_t<!std::is_same<std::decay_t<TParams>, QVariantHash>::value>>
+	inline void showForResult(quint32 requestCode, TParams &&params) const;
 	//! @copybrief ViewModel::showForResult(quint32, const QVariantHash &) const
 	void showForResult(quint32 requestCode, const char *viewModelName, const QVariantHash &params = {}) const;
 	//! @copybrief ViewModel::showForResult(quint32, const QVariantHash &) const
@@ -59,10 +68,14 @@ protected:
 private:
 	friend class QtMvvm::CoreApp;
 	friend class QtMvvm::CoreAppPrivate;
+	friend class QtMvvm::ViewModelTrackerPrivate;
 
 	QScopedPointer<ViewModelPrivate> d;
 
 	static void showImp(const QMetaObject *metaObject, const QVariantHash &params, QPointer<ViewModel> parent, quint32 requestCode = 0);
+	static void showImp(const QMetaObject *metaObject, std::function<void(ViewModel*)> typedInit, QPointer<ViewModel> parent, quint32 requestCode = 0);
+	template <typename TViewModel, typename TParams>
+	static inline std::function<void(ViewModel*)> packTypedInit(TParams &&params);
 };
 
 //! A macro that makes a viewmodel a singleton viewmodel
@@ -87,6 +100,30 @@ void ViewModel::showForResult(quint32 requestCode, const QVariantHash &params) c
 	showImp(&TViewModel::staticMetaObject, params, const_cast<ViewModel*>(this), requestCode);
 }
 
+template<typename TViewModel, typename TParams, typename>
+inline void ViewModel::show(TParams &&params) const
+{
+	static_assert(std::is_base_of<ViewModel, TViewModel>::value, "TViewModel must extend QtMvvm::ViewModel");
+	showImp(&TViewModel::staticMetaObject, packTypedInit<TViewModel>(std::forward<TParams>(params)), const_cast<ViewModel*>(this));
+}
+
+template<typename TViewModel, typename TParams, typename>
+inline void ViewModel::showForResult(quint32 requestCode, TParams &&params) const
+{
+	static_assert(std::is_base_of<ViewModel, TViewModel>::value, "TViewModel must extend QtMvvm::ViewModel");
+	showImp(&TViewModel::staticMetaObject, packTypedInit<TViewModel>(std::forward<TParams>(params)), const_cast<ViewModel*>(this), requestCode);
+}
+
+template<typename TViewModel, typename TParams>
+inline std::function<void(ViewModel*)> ViewModel::packTypedInit(TParams &&params)
+{
+	// the payload is moved into a shared holder once, so the queued call only copies the pointer
+	auto holder = QSharedPointer<std::decay_t<TParams>>::create(std::forward<TParams>(params));
+	return [holder](ViewModel *viewModel) {
+		static_cast<TViewModel*>(viewModel)->onInitParams(std::move(*holder));
+	};
+}
+
 }
 
 Q_DECLARE_METATYPE(QtMvvm::ViewModel*)
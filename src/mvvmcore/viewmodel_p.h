@@ -1,12 +1,22 @@
 #ifndef QTMVVM_VIEWMODEL_P_H
 #define QTMVVM_VIEWMODEL_P_H
 
+#include <QtCore/QAtomicInt>
+
 #include "qtmvvmcore_global.h"
 #include "viewmodel.h"
 
 namespace QtMvvm {
 
-class ViewModelPrivate {};
+class ViewModelPrivate
+{
+public:
+	ViewModelPrivate();
+
+	qint64 created;
+	// number of viewmodels shown for a result that did not deliver one yet
+	QAtomicInt pendingResults = 0;
+};
 
 }
 
@@ -0,0 +1,143 @@
+#include "viewmodeltracker.h"
+#include "viewmodeltracker_p.h"
+#include "viewmodel.h"
+#include "viewmodel_p.h"
+#include <QtCore/QAbstractItemModel>
+#include <QtCore/QMetaClassInfo>
+#include <QtCore/QDateTime>
+#include <QtCore/QFile>
+#include <QtCore/QTextStream>
+#include <algorithm>
+using namespace QtMvvm;
+
+Q_GLOBAL_STATIC(ViewModelTrackerPrivate, tracker)
+
+int ViewModelTracker::liveCount()
+{
+	auto data = tracker();
+	QMutexLocker lock{&data->mutex};
+	return data->viewModels.size();
+}
+
+QList<ViewModelTracker::Instance> ViewModelTracker::instances()
+{
+	auto data = tracker();
+	QMutexLocker lock{&data->mutex};
+	QList<Instance> instances;
+	instances.reserve(data->viewModels.size());
+	for(auto viewModel : qAsConst(data->viewModels))
+		instances.append(ViewModelTrackerPrivate::collect(viewModel));
+	lock.unlock();
+
+	std::sort(instances.begin(), instances.end(), [](const Instance &lhs, const Instance &rhs) {
+		return lhs.created < rhs.created;
+	});
+	return instances;
+}
+
+QList<ViewModelTracker::TypeSummary> ViewModelTracker::summary()
+{
+	QHash<const QMetaObject*, TypeSummary> types;
+	for(const auto &instance : instances()) {
+		auto &type = types[instance.metaObject];
+		if(type.count == 0) {
+			type.metaObject = instance.metaObject;
+			type.oldestCreated = instance.created;
+		} else
+			type.oldestCreated = qMin(type.oldestCreated, instance.created);
+		type.count++;
+		type.childObjects += instance.childObjects;
+		type.modelRows += instance.modelRows;
+		type.pendingResults += instance.pendingResults;
+	}
+
+	auto summary = types.values();
+	std::sort(summary.begin(), summary.end(), [](const TypeSummary &lhs, const TypeSummary &rhs) {
+		return lhs.count > rhs.count;
+	});
+	return summary;
+}
+
+bool ViewModelTracker::dump(QIODevice *device)
+{
+	if(!device->isWritable())
+		return false;
+
+	const auto now = QDateTime::currentMSecsSinceEpoch();
+	const auto allInstances = instances();
+	QTextStream stream{device};
+	stream << "QtMvvm viewmodels: " << allInstances.size() << " alive\n";
+	for(const auto &type : summary()) {
+		stream << "  " << type.metaObject->className()
+			   << ": count=" << type.count
+			   << " oldestAge=" << (now - type.oldestCreated) << "ms"
+			   << " children=" << type.childObjects
+			   << " rows=" << type.modelRows
+			   << " pendingResults=" << type.pendingResults << '\n';
+	}
+	stream << "Instances, oldest first:\n";
+	for(const auto &instance : allInstances) {
+		stream << "  " << instance.metaObject->className()
+			   << (instance.singleton ? " (singleton)" : "")
+			   << ": age=" << (now - instance.created) << "ms"
+			   << " children=" << instance.childObjects
+			   << " rows=" << instance.modelRows
+			   << " pendingResults=" << instance.pendingResults
+			   << " parents=[" << instance.parentChain.join(QStringLiteral(" > ")) << "]\n";
+	}
+	stream.flush();
+	return stream.status() == QTextStream::Ok;
+}
+
+bool ViewModelTracker::dump(const QString &filePath)
+{
+	QFile file{filePath};
+	if(!file.open(QIODevice::WriteOnly | QIODevice::Text | QIODevice::Truncate))
+		return false;
+	return dump(&file);
+}
+
+// ------------- Private Implementation -------------
+
+void ViewModelTrackerPrivate::add(ViewModel *viewModel)
+{
+	auto data = tracker();
+	if(!data)
+		return;
+	QMutexLocker lock{&data->mutex};
+	data->viewModels.insert(viewModel);
+}
+
+void ViewModelTrackerPrivate::remove(ViewModel *viewModel)
+{
+	auto data = tracker();
+	if(!data)
+		return;
+	QMutexLocker lock{&data->mutex};
+	data->viewModels.remove(viewModel);
+}
+
+ViewModelTracker::Instance ViewModelTrackerPrivate::collect(ViewModel *viewModel)
+{
+	ViewModelTracker::Instance instance;
+	instance.viewModel = viewModel;
+	instance.metaObject = viewModel->metaObject();
+	instance.created = viewModel->d->created;
+	instance.pendingResults = viewModel->d->pendingResults.load();
+
+	auto singletonIndex = instance.metaObject->indexOfClassInfo("qtmvvm_singleton");
+	instance.singleton = singletonIndex != -1 &&
+						 qstrcmp(instance.metaObject->classInfo(singletonIndex).value(), "true") == 0;
+
+	for(auto parent = viewModel->parent(); parent; parent = parent->parent())
+		instance.parentChain.append(QString::fromUtf8(parent->metaObject()->className()));
+
+	const auto children = viewModel->findChildren<QObject*>();
+	instance.childObjects = children.size();
+	for(auto child : children) {
+		auto model = qobject_cast<QAbstractItemModel*>(child);
+		if(model)
+			instance.modelRows += model->rowCount();
+	}
+	return instance;
+}
@@ -0,0 +1,80 @@
+#ifndef QTMVVM_VIEWMODELTRACKER_H
+#define QTMVVM_VIEWMODELTRACKER_H
+
+#include <QtCore/qlist.h>
+#include <QtCore/qstring.h>
+#include <QtCore/qstringlist.h>
+#include <QtCore/qpointer.h>
+
+#include "QtMvvmCore/qtmvvmcore_global.h"
+
+QT_BEGIN_NAMESPACE
+class QIODevice;
+QT_END_NAMESPACE
+
+namespace QtMvvm {
+
+class ViewModel;
+
+//! Keeps track of all living viewmodels, to find leaks and long lived instances
+class Q_MVVMCORE_EXPORT ViewModelTracker
+{
+	Q_DISABLE_COPY(ViewModelTracker)
+
+public:
+	//! Information about a single living viewmodel
+	struct Instance {
+		//! The viewmodel itself
+		QPointer<ViewModel> viewModel;
+		//! The type of the viewmodel
+		const QMetaObject *metaObject = nullptr;
+		//! The time the viewmodel was created, in milliseconds since the epoch
+		qint64 created = 0;
+		//! The class names of all parent objects, starting with the direct parent
+		QStringList parentChain;
+		//! The number of all (recursive) child objects of the viewmodel
+		int childObjects = 0;
+		//! The number of top level rows of all item models owned by the viewmodel
+		int modelRows = 0;
+		//! The number of shown viewmodels the viewmodel still waits on for a result
+		int pendingResults = 0;
+		//! Specifies if the viewmodel is a singleton
+		bool singleton = false;
+	};
+
+	//! Accumulated information about all living viewmodels of one type
+	struct TypeSummary {
+		//! The type of the viewmodels
+		const QMetaObject *metaObject = nullptr;
+		//! The number of living instances
+		int count = 0;
+		//! The creation time of the oldest instance, in milliseconds since the epoch
+		qint64 oldestCreated = 0;
+		//! @copybrief Instance::childObjects
+		int childObjects = 0;
+		//! @copybrief Instance::modelRows
+		int modelRows = 0;
+		//! @copybrief Instance::pendingResults
+		int pendingResults = 0;
+	};
+
+	//! Returns the number of living viewmodels. Can be called from any thread
+	static int liveCount();
+	//! Returns information about every living viewmodel
+	static QList<Instance> instances();
+	//! Returns the living viewmodels grouped by their type, the type with most instances first
+	static QList<TypeSummary> summary();
+
+	//! Writes the summary and all instances as human readable text to the device
+	static bool dump(QIODevice *device);
+	//! Writes the summary and all instances as human readable text to the given file
+	static bool dump(const QString &filePath);
+
+private:
+	ViewModelTracker() = delete;
+};
+
+}
+
+//! @file viewmodeltracker.h The ViewModelTracker class header
+#endif // QTMVVM_VIEWMODELTRACKER_H
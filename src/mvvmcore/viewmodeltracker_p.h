@@ -0,0 +1,26 @@
+#ifndef QTMVVM_VIEWMODELTRACKER_P_H
+#define QTMVVM_VIEWMODELTRACKER_P_H
+
+#include <QtCore/QMutex>
+#include <QtCore/QSet>
+
+#include "qtmvvmcore_global.h"
+#include "viewmodeltracker.h"
+
+namespace QtMvvm {
+
+class ViewModelTrackerPrivate
+{
+public:
+	static void add(ViewModel *viewModel);
+	static void remove(ViewModel *viewModel);
+
+	static ViewModelTracker::Instance collect(ViewModel *viewModel);
+
+	QMutex mutex;
+	QSet<ViewModel*> viewModels;
+};
+
+}
+
+#endif // QTMVVM_VIEWMODELTRACKER_P_H
@@ -116,16 +116,16 @@ QVariant AccountModel::data(const QModelIndex &index, int role) const
 	case 0:
 		switch(role) {
 		case NameRole:
-			return d->devices.value(index.row()).name();
+			return d->devices.value(index.row()).info.name();
 		case FingerPrintRole:
-			return DataSyncViewModel::formatFingerPrint(d->devices.value(index.row()).fingerprint());
+			return d->devices.value(index.row()).fingerPrint;
 		default:
 			break;
 		}
 		break;
 	case 1:
 		if(role == Qt::DisplayRole)
-			return DataSyncViewModel::formatFingerPrint(d->devices.value(index.row()).fingerprint());
+			return d->devices.value(index.row()).fingerPrint;
 		break;
 	default:
 		break;
@@ -152,7 +152,7 @@ bool AccountModel::removeDevice(const QModelIndex &index)
 		return false;
 #endif
 	else {
-		d->accountManager->removeDevice(d->devices.value(index.row()));
+		d->accountManager->removeDevice(d->devices.value(index.row()).info);
 		return true;
 	}
 }
@@ -172,7 +172,10 @@ void AccountModel::reload()
 void AccountModel::accountDevices(const QList<DeviceInfo> &devices)
 {
 	beginResetModel();
-	d->devices = devices;
+	d->devices.clear();
+	d->devices.reserve(devices.size());
+	for(const auto &device : devices)
+		d->devices.append(device);
 	endResetModel();
 	logDebug() << "Device list updated with" << devices.size() << "devices";
 }
@@ -193,3 +196,10 @@ void AccountModel::update(SyncManager::SyncState state)
 		reload();
 	}
 }
+
+// ------------- Private Implementation -------------
+
+AccountModelPrivate::DeviceEntry::DeviceEntry(const DeviceInfo &info) :
+	info(info),
+	fingerPrint(DataSyncViewModel::formatFingerPrint(info.fingerprint()))
+{}
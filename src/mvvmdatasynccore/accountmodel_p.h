@@ -11,11 +11,18 @@ class AccountModelPrivate
 	Q_DISABLE_COPY(AccountModelPrivate)
 
 public:
+	struct DeviceEntry {
+		DeviceEntry(const QtDataSync::DeviceInfo &info = {});
+
+		QtDataSync::DeviceInfo info;
+		QString fingerPrint;
+	};
+
 	AccountModelPrivate() = default;
 
 	QtDataSync::AccountManager *accountManager = nullptr;
 	QtDataSync::SyncManager *syncManager = nullptr;
-	QList<QtDataSync::DeviceInfo> devices;
+	QList<DeviceEntry> devices;
 	bool reloaded = true;
 };
 
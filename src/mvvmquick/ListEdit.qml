@@ -1,15 +1,24 @@
 import QtQuick 2.10
 import QtQuick.Controls 2.3
+import de.skycoder42.QtMvvm.Quick 1.1
 
 ComboBox {
 	id: _edit
 	property var inputValue
-	property alias listElements: _edit.model
-	readonly property bool isExtended: Boolean(model[0] && model[0].name)
+	// either a list of elements or a ListElementsModel that is shared with the delegate
+	property var listElements: []
+	readonly property ListElementsModel elementsModel: _isModel ? listElements : _localModel
 
+	readonly property bool _isModel: Boolean(listElements) && typeof listElements.valueAt === "function"
 	property bool _skipNext: false
 
-	textRole: isExtended ? "name" : ""
+	model: elementsModel
+	textRole: "name"
+
+	ListElementsModel {
+		id: _localModel
+		listElements: _edit._isModel ? [] : _edit.listElements
+	}
 
 	onInputValueChanged: {
 		if(_skipNext) {
@@ -18,26 +27,10 @@ ComboBox {
 		} else
 			_skipNext = true;
 
-		var found = false;
-		var i;
-		if(isExtended) {
-			for(i = 0; i < model.length; i++) {
-				if(model[i].value == inputValue) {
-					currentIndex = i;
-					found = true;
-					break;
-				}
-			}
-		} else {
-			for(i = 0; i < model.length; i++) {
-				if(model[i] == inputValue) {
-					currentIndex = i;
-					found = true;
-					break;
-				}
-			}
-		}
-		if(!found)
+		var index = elementsModel.indexOf(inputValue);
+		if(index !== -1)
+			currentIndex = index;
+		else
 			editText = inputValue;
 	}
 
@@ -48,13 +41,12 @@ ComboBox {
 		} else
 			_skipNext = true;
 
-		if(isExtended) {
-			var value = model[currentIndex].value;
-			if(typeof value !== "undefined")
-				inputValue = value;
-			else
-				inputValue = editText;
-		} else
-			inputValue = editText
+		var value = elementsModel.valueAt(currentIndex);
+		if(typeof value !== "undefined")
+			inputValue = value;
+		else
+			inputValue = editText;
 	}
+
+	Component.onCompleted: elementsModel.filterText = ""
 }
@@ -1,22 +1,51 @@
 import QtQuick 2.10
 import QtQuick.Controls 2.3
+import de.skycoder42.QtMvvm.Quick 1.1
 
 ListView {
 	id: _edit
 	property var inputValue
-	property alias listElements: _edit.model
-	readonly property bool isExtended: Boolean(model[0] && model[0].name)
+	// either a list of elements or a ListElementsModel that is shared with the delegate
+	property var listElements: []
+	readonly property ListElementsModel elementsModel: _isModel ? listElements : _localModel
+	// the most rows shown at once. Only the visible rows are created
+	property int maxVisibleItems: 8
+	// lists with more elements get a filter field
+	property int filterThreshold: 20
 
-	implicitHeight: dummyDelegate.height * model.length
+	readonly property bool _isModel: Boolean(listElements) && typeof listElements.valueAt === "function"
+	readonly property bool _hasFilter: elementsModel.elementCount > filterThreshold
+
+	implicitHeight: dummyDelegate.height * Math.min(elementsModel.elementCount, maxVisibleItems) +
+					(headerItem ? headerItem.height : 0)
+	clip: true
+	model: elementsModel
 
 	ScrollBar.vertical: ScrollBar {}
 
+	headerPositioning: ListView.OverlayHeader
+	header: Pane {
+		width: _edit.width
+		height: _edit._hasFilter ? implicitHeight : 0
+		visible: _edit._hasFilter
+		z: 2
+		padding: 0
+
+		TextField {
+			id: _filterField
+			width: parent.width
+			placeholderText: qsTr("Filter…")
+			inputMethodHints: Qt.ImhNoPredictiveText
+			onTextChanged: _edit.elementsModel.filterText = text
+		}
+	}
+
 	delegate: RadioDelegate {
-		width: parent.width
-		text: isExtended ? _edit.model[index].name : modelData
+		width: _edit.width
+		text: model.name
 
-		checked: (isExtended ? _edit.model[index].value : modelData) == inputValue
-		onClicked: inputValue = (isExtended ? _edit.model[index].value : modelData)
+		checked: model.value == _edit.inputValue
+		onClicked: _edit.inputValue = model.value
 	}
 
 	RadioDelegate {
@@ -24,4 +53,12 @@ ListView {
 		visible: false
 		text: "dummy"
 	}
+
+	Component.onCompleted: {
+		// the shared model may still be filtered from a previous dialog
+		elementsModel.filterText = "";
+		var index = elementsModel.indexOf(inputValue);
+		if(index !== -1)
+			positionViewAtIndex(index, ListView.Center);
+	}
 }
@@ -5,6 +5,7 @@
 #include <QtCore/QDateTime>
 
 #include "inputviewfactory.h"
+#include "listelementsmodel_p.h"
 
 namespace QtMvvm {
 
@@ -23,8 +24,14 @@ class ListFormatter : public Formatter
 {
 public:
 	QString format(const QString &formatString, const QVariant &value, const QVariantMap &viewProperties) const override {
-		if(viewProperties.contains(QStringLiteral("listElements"))) {
-			for(const auto &element : viewProperties.value(QStringLiteral("listElements")).toList()) {
+		auto listElements = viewProperties.value(QStringLiteral("listElements"));
+		auto model = ListElementsModel::fromProperty(listElements);
+		if(model) {
+			auto name = model->nameOf(value);
+			if(!name.isNull())
+				return formatString.arg(name);
+		} else if(listElements.isValid()) {
+			for(const auto &element : listElements.toList()) {
 				if(element.type() != QVariant::Map)
 					continue;
 				auto eMap = element.toMap();
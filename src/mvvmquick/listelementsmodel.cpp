@@ -0,0 +1,150 @@
+#include "listelementsmodel_p.h"
+#include <algorithm>
+using namespace QtMvvm;
+
+ListElementsModel *ListElementsModel::fromProperty(const QVariant &listElements)
+{
+	if(listElements.canConvert<QObject*>())
+		return qobject_cast<ListElementsModel*>(listElements.value<QObject*>());
+	else
+		return nullptr;
+}
+
+ListElementsModel::ListElementsModel(QObject *parent) :
+	QAbstractListModel{parent}
+{}
+
+ListElementsModel::ListElementsModel(const QVariantList &listElements, QObject *parent) :
+	ListElementsModel{parent}
+{
+	setListElements(listElements);
+}
+
+QVariantList ListElementsModel::listElements() const
+{
+	return _elements.listElements();
+}
+
+QString ListElementsModel::filterText() const
+{
+	return _filterText;
+}
+
+int ListElementsModel::count() const
+{
+	return _filtered ? _rows.size() : _elements.size();
+}
+
+int ListElementsModel::elementCount() const
+{
+	return _elements.size();
+}
+
+int ListElementsModel::indexOf(const QVariant &value) const
+{
+	auto element = _elements.indexOf(value);
+	if(element == -1 || !_filtered)
+		return element;
+	auto it = std::lower_bound(_rows.constBegin(), _rows.constEnd(), element);
+	if(it != _rows.constEnd() && *it == element)
+		return static_cast<int>(std::distance(_rows.constBegin(), it));
+	else
+		return -1;
+}
+
+QString ListElementsModel::nameAt(int row) const
+{
+	auto element = elementIndex(row);
+	return element == -1 ? QString{} : _elements.at(element).name;
+}
+
+QVariant ListElementsModel::valueAt(int row) const
+{
+	auto element = elementIndex(row);
+	return element == -1 ? QVariant{} : _elements.at(element).value;
+}
+
+QString ListElementsModel::nameOf(const QVariant &value) const
+{
+	auto element = _elements.indexOf(value);
+	return element == -1 ? QString{} : _elements.at(element).name;
+}
+
+int ListElementsModel::rowCount(const QModelIndex &parent) const
+{
+	if(parent.isValid())
+		return 0;
+	else
+		return count();
+}
+
+QVariant ListElementsModel::data(const QModelIndex &index, int role) const
+{
+	if(!checkIndex(index, CheckIndexOption::IndexIsValid | CheckIndexOption::ParentIsInvalid))
+		return {};
+
+	const auto &element = _elements.at(elementIndex(index.row()));
+	switch(role) {
+	case NameRole:
+		return element.name;
+	case ValueRole:
+		return element.value;
+	default:
+		return {};
+	}
+}
+
+QHash<int, QByteArray> ListElementsModel::roleNames() const
+{
+	return {
+		{NameRole, "name"},
+		{ValueRole, "value"}
+	};
+}
+
+void ListElementsModel::setListElements(const QVariantList &listElements)
+{
+	beginResetModel();
+	_elements = ListElements{listElements};
+	if(_filtered)
+		applyFilter();
+	endResetModel();
+
+	emit listElementsChanged();
+	emit countChanged();
+}
+
+void ListElementsModel::setFilterText(const QString &filterText)
+{
+	if(_filterText == filterText)
+		return;
+
+	beginResetModel();
+	_filterText = filterText;
+	_filtered = !_filterText.isEmpty();
+	if(_filtered)
+		applyFilter();
+	else
+		_rows.clear();
+	endResetModel();
+
+	emit filterTextChanged(_filterText);
+	emit countChanged();
+}
+
+int ListElementsModel::elementIndex(int row) const
+{
+	if(row < 0 || row >= count())
+		return -1;
+	else
+		return _filtered ? _rows[row] : row;
+}
+
+void ListElementsModel::applyFilter()
+{
+	_rows.clear();
+	for(auto i = 0; i < _elements.size(); i++) {
+		if(_elements.at(i).name.contains(_filterText, Qt::CaseInsensitive))
+			_rows.append(i);
+	}
+}
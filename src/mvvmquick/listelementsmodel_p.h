@@ -0,0 +1,77 @@
+#ifndef QTMVVM_LISTELEMENTSMODEL_P_H
+#define QTMVVM_LISTELEMENTSMODEL_P_H
+
+#include <QtCore/QAbstractListModel>
+#include <QtCore/QHash>
+#include <QtCore/QVector>
+#include <QtCore/QVariant>
+
+#include <QtMvvmCore/private/listelements_p.h>
+
+#include "qtmvvmquick_global.h"
+
+namespace QtMvvm {
+
+// read only model of the listElements of the list inputs, with value lookup and name filtering
+class Q_MVVMQUICK_EXPORT ListElementsModel : public QAbstractListModel
+{
+	Q_OBJECT
+
+	Q_PROPERTY(QVariantList listElements READ listElements WRITE setListElements NOTIFY listElementsChanged)
+	Q_PROPERTY(QString filterText READ filterText WRITE setFilterText NOTIFY filterTextChanged)
+	Q_PROPERTY(int count READ count NOTIFY countChanged)
+	Q_PROPERTY(int elementCount READ elementCount NOTIFY listElementsChanged)
+
+public:
+	enum Roles {
+		NameRole = Qt::DisplayRole,
+		ValueRole = Qt::UserRole + 1
+	};
+	Q_ENUM(Roles)
+
+	// returns the model if listElements already is one
+	static ListElementsModel *fromProperty(const QVariant &listElements);
+
+	explicit ListElementsModel(QObject *parent = nullptr);
+	explicit ListElementsModel(const QVariantList &listElements, QObject *parent = nullptr);
+
+	QVariantList listElements() const;
+	QString filterText() const;
+	int count() const;
+	int elementCount() const;
+
+	// row of the value in the filtered model, or -1
+	Q_INVOKABLE int indexOf(const QVariant &value) const;
+	Q_INVOKABLE QString nameAt(int row) const;
+	Q_INVOKABLE QVariant valueAt(int row) const;
+	// name of the value, independent of the filter. Returns a null string if not found
+	Q_INVOKABLE QString nameOf(const QVariant &value) const;
+
+	int rowCount(const QModelIndex &parent = {}) const override;
+	QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+	QHash<int, QByteArray> roleNames() const override;
+
+public Q_SLOTS:
+	void setListElements(const QVariantList &listElements);
+	void setFilterText(const QString &filterText);
+
+Q_SIGNALS:
+	void listElementsChanged();
+	void filterTextChanged(const QString &filterText);
+	void countChanged();
+
+private:
+	ListElements _elements;
+
+	QString _filterText;
+	bool _filtered = false;
+	// filtered row -> element, only used while filtered
+	QVector<int> _rows;
+
+	int elementIndex(int row) const;
+	void applyFilter();
+};
+
+}
+
+#endif // QTMVVM_LISTELEMENTSMODEL_P_H
@@ -8,11 +8,13 @@ HEADERS += \
 	quickpresenter_p.h \
 	inputviewfactory.h \
 	inputviewfactory_p.h \
-	formatters_p.h
+	formatters_p.h \
+	listelementsmodel_p.h
 
 SOURCES += \
 	quickpresenter.cpp \
-	inputviewfactory.cpp
+	inputviewfactory.cpp \
+	listelementsmodel.cpp
 
 RESOURCES += \
 	qtmvvmquick_module.qrc
@@ -10,6 +10,8 @@
 #include <QtMvvmCore/exception.h>
 
 #include <QtQml/qqml.h>
+#include <QtQml/QQmlContext>
+#include <QtQml/QQmlEngine>
 
 #include <QtMvvmCore/private/qtmvvm_logging_p.h>
 
@@ -64,11 +66,11 @@ void QuickPresenter::present(QtMvvm::ViewModel *viewModel, const QVariantHash &p
 	if(d->qmlPresenter) {
 		auto url = findViewUrl(viewModel->metaObject());
 		logDebug() << "Handing over viewModel" << viewModel->metaObject()->className() << "to QML presenter";
-		QMetaObject::invokeMethod(d->qmlPresenter, "present",
-								  Q_ARG(QtMvvm::ViewModel*, viewModel),
-								  Q_ARG(QVariantHash, params),
-								  Q_ARG(QUrl, url),
-								  Q_ARG(QPointer<QtMvvm::ViewModel>, parent));
+		d->qmlPresentMethod.invoke(d->qmlPresenter,
+								   Q_ARG(QtMvvm::ViewModel*, viewModel),
+								   Q_ARG(QVariantHash, params),
+								   Q_ARG(QUrl, url),
+								   Q_ARG(QPointer<QtMvvm::ViewModel>, parent));
 	} else
 		throw PresenterException("QML presenter not ready - cannot present yet");
 }
@@ -77,9 +79,9 @@ void QuickPresenter::showDialog(const QtMvvm::MessageConfig &config, QtMvvm::Mes
 {
 	if(d->qmlPresenter) {
 		logDebug() << "Handing over dialog of type" << config.type() << "to QML presenter";
-		QMetaObject::invokeMethod(d->qmlPresenter, "showDialog",
-								  Q_ARG(QtMvvm::MessageConfig, config),
-								  Q_ARG(QtMvvm::MessageResult*, result));
+		d->qmlShowDialogMethod.invoke(d->qmlPresenter,
+									  Q_ARG(QtMvvm::MessageConfig, config),
+									  Q_ARG(QtMvvm::MessageResult*, result));
 	} else
 		throw PresenterException("QML presenter not ready - cannot present yet");
 }
@@ -87,6 +89,14 @@ void QuickPresenter::showDialog(const QtMvvm::MessageConfig &config, QtMvvm::Mes
 bool QuickPresenter::presentToQml(QObject *qmlPresenter, QObject *viewObject)
 {
 	auto meta = qmlPresenter->metaObject();
+	// the meta object address may be reused by a different presenter, so cached methods must not outlive it
+	if(!d->cachedPresenters.contains(meta)) {
+		d->cachedPresenters.insert(meta);
+		connect(qmlPresenter, &QObject::destroyed,
+				this, [this, meta](){
+			d->removeCachedPresenter(meta);
+		});
+	}
 	auto index = presentMethodIndex(meta, viewObject);
 	QVariant presented = false;
 	if(index != -1) {
@@ -165,6 +175,28 @@ QUrl QuickPresenter::findViewUrl(const QMetaObject *viewModelType)
 
 int QuickPresenter::presentMethodIndex(const QMetaObject *presenterMetaObject, QObject *viewObject)
 {
+	// the class hierarchy never changes, so only the object name has to be checked for every view
+	quint8 nameHints = PresentMethodKey::NoHint;
+	const auto objName = viewObject->objectName();
+	if(objName.contains(QStringLiteral("Drawer"), Qt::CaseInsensitive))
+		nameHints |= PresentMethodKey::DrawerHint;
+	if(objName.contains(QStringLiteral("Tab"), Qt::CaseInsensitive))
+		nameHints |= PresentMethodKey::TabHint;
+	// every QML instance has its own meta object, so QML views are identified by their component
+	PresentMethodKey key {presenterMetaObject, viewObject->metaObject(), {}, nameHints};
+	auto context = QQmlEngine::contextForObject(viewObject);
+	if(context && context->baseUrl().isValid()) {
+		key.viewMetaObject = nullptr;
+		key.viewUrl = context->baseUrl();
+	}
+	auto cached = d->presentMethodCache.constFind(key);
+	if(cached != d->presentMethodCache.constEnd()) {
+		logDebug() << "Presenting" << viewObject->metaObject()->className()
+				   << "with cached method" << (*cached != -1 ? presenterMetaObject->method(*cached).name() : QByteArray{})
+				   << "of presenter" << presenterMetaObject->className();
+		return *cached;
+	}
+
 	auto index = -1;
 	if(viewObject->inherits("QQuickPopup")) {
 		index = presenterMetaObject->indexOfMethod("presentPopup(QVariant)");
@@ -196,6 +228,7 @@ int QuickPresenter::presentMethodIndex(const QMetaObject *presenterMetaObject, Q
 			}
 		}
 	}
+	d->presentMethodCache.insert(key, index);
 	return index;
 }
 
@@ -230,5 +263,35 @@ QuickPresenter *QuickPresenterPrivate::currentPresenter()
 
 void QuickPresenterPrivate::setQmlPresenter(QObject *presenter)
 {
-	currentPresenter()->d->qmlPresenter = presenter;
+	auto d = currentPresenter()->d.data();
+	d->qmlPresenter = presenter;
+	d->presentMethodCache.clear();
+	if(presenter) {
+		auto meta = presenter->metaObject();
+		d->qmlPresentMethod = meta->method(meta->indexOfMethod(QMetaObject::normalizedSignature(
+			"present(QtMvvm::ViewModel*,QVariantHash,QUrl,QPointer<QtMvvm::ViewModel>)")));
+		d->qmlShowDialogMethod = meta->method(meta->indexOfMethod(QMetaObject::normalizedSignature(
+			"showDialog(QtMvvm::MessageConfig,QtMvvm::MessageResult*)")));
+		Q_ASSERT_X(d->qmlPresentMethod.isValid() && d->qmlShowDialogMethod.isValid(),
+				   Q_FUNC_INFO, "The QML presenter must have the present and showDialog slots");
+	} else {
+		d->qmlPresentMethod = QMetaMethod{};
+		d->qmlShowDialogMethod = QMetaMethod{};
+	}
+}
+
+void QuickPresenterPrivate::clearPresentMethodCache()
+{
+	currentPresenter()->d->presentMethodCache.clear();
+}
+
+void QuickPresenterPrivate::removeCachedPresenter(const QMetaObject *presenterMetaObject)
+{
+	cachedPresenters.remove(presenterMetaObject);
+	for(auto it = presentMethodCache.begin(); it != presentMethodCache.end();) {
+		if(it.key().presenterMetaObject == presenterMetaObject)
+			it = presentMethodCache.erase(it);
+		else
+			++it;
+	}
 }
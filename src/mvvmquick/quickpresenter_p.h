@@ -2,13 +2,45 @@
 #define QTMVVM_QUICKPRESENTER_P_H
 
 #include <QtCore/QHash>
+#include <QtCore/QSet>
 #include <QtCore/QPointer>
+#include <QtCore/QMetaMethod>
+#include <QtCore/QUrl>
 
 #include "qtmvvmquick_global.h"
 #include "quickpresenter.h"
 
 namespace QtMvvm {
 
+struct PresentMethodKey {
+	enum NameHint : quint8 {
+		NoHint = 0x00,
+		DrawerHint = 0x01,
+		TabHint = 0x02
+	};
+
+	const QMetaObject *presenterMetaObject;
+	// only set for views that were not created by QML
+	const QMetaObject *viewMetaObject;
+	// the url of the component a QML view was created from
+	QUrl viewUrl;
+	quint8 nameHints;
+};
+
+inline bool operator==(const PresentMethodKey &lhs, const PresentMethodKey &rhs) {
+	return lhs.presenterMetaObject == rhs.presenterMetaObject &&
+			lhs.viewMetaObject == rhs.viewMetaObject &&
+			lhs.viewUrl == rhs.viewUrl &&
+			lhs.nameHints == rhs.nameHints;
+}
+
+inline uint qHash(const PresentMethodKey &key, uint seed = 0) {
+	return ::qHash(key.presenterMetaObject, seed) ^
+			::qHash(key.viewMetaObject, seed) ^
+			::qHash(key.viewUrl, seed) ^
+			::qHash(key.nameHints, seed);
+}
+
 class Q_MVVMQUICK_EXPORT QuickPresenterPrivate
 {
 	Q_DISABLE_COPY(QuickPresenterPrivate)
@@ -19,9 +51,18 @@ public:
 
 	static QuickPresenter *currentPresenter();
 	static void setQmlPresenter(QObject *presenter);
+	static void clearPresentMethodCache();
+
+	void removeCachedPresenter(const QMetaObject *presenterMetaObject);
 
 private:
 	QPointer<QObject> qmlPresenter;
+	QMetaMethod qmlPresentMethod;
+	QMetaMethod qmlShowDialogMethod;
+	// QML presenters have their own meta object, that is only valid as long as the presenter
+	QHash<PresentMethodKey, int> presentMethodCache;
+	// presenter meta objects whose entries are removed once the tracked presenter is destroyed
+	QSet<const QMetaObject*> cachedPresenters;
 	InputViewFactory *inputViewFactory = nullptr;
 
 	QHash<const QMetaObject *, QUrl> explicitMappings;
@@ -1,18 +1,29 @@
 #include "selectcombobox_p.h"
+#include <QtWidgets/QCompleter>
+#include <QtWidgets/QLineEdit>
+#include <QtWidgets/QListView>
 using namespace QtMvvm;
 
 SelectComboBox::SelectComboBox(QWidget *parent) :
 	QComboBox(parent)
 {
+	// the popup only creates the visible rows if they all have the same height
+	auto listView = qobject_cast<QListView*>(view());
+	if(listView)
+		listView->setUniformItemSizes(true);
+
 	connect(this, &SelectComboBox::currentTextChanged,
 			this, &SelectComboBox::currentValueChanged);
 	connect(this, &SelectComboBox::editTextChanged,
-			this, &SelectComboBox::currentValueChanged);
+			this, [this](){
+		if(!_filterOnly)
+			emit currentValueChanged();
+	});
 }
 
 QVariant SelectComboBox::currentValue() const
 {
-	if(currentText() != itemText(currentIndex()))
+	if(!_filterOnly && currentText() != itemText(currentIndex()))
 		return currentText();
 	else
 		return currentData();
@@ -20,45 +31,147 @@ QVariant SelectComboBox::currentValue() const
 
 QVariantList SelectComboBox::listElements() const
 {
-	QVariantList res;
-	auto mCount = count();
-	res.reserve(mCount);
-	for(auto i = 0; i < mCount; i++) {
-		auto key = itemText(i);
-		auto value = itemData(i);
-		if(key == value)
-			res.append(key);
-		else {
-			QVariantMap map;
-			map.insert(QStringLiteral("name"), key);
-			map.insert(QStringLiteral("value"), value);
-			res.append(map);
-		}
-	}
-	return res;
+	if(_model)
+		return _model->listElements();
+	else
+		return {};
+}
+
+bool SelectComboBox::hasFilterPopup() const
+{
+	return _filterPopup;
 }
 
 void SelectComboBox::setCurrentValue(const QVariant &data)
 {
-	auto index = findData(data);
+	auto index = _model ? _model->findValue(data) : findData(data);
 	if(index != -1)
 		setCurrentIndex(index);
-	else if(isEditable())
+	else if(isEditable() && !_filterOnly)
 		setCurrentText(data.toString());
 }
 
 void SelectComboBox::setListElements(const QVariantList &listElements)
 {
-	clear();
-	for(const auto &item : listElements) {
-		if(item.type() == QVariant::String)
-			addItem(item.toString(), item);
-		else {
-			auto iData = item.toMap();
-			addItem(iData.value(QStringLiteral("name")).toString(),
-					iData.value(QStringLiteral("value")));
+	auto model = SelectListModel::shared(listElements);
+	if(model == _model)
+		return;
+	// replaced models are deleted later, so the box can safely switch
+	_model = model;
+	setModel(_model.data());
+	if(_filterPopup && completer())
+		completer()->setModel(_model.data());
+	emit listElementsChanged(listElements);
+}
+
+void SelectComboBox::setFilterPopup(bool filterPopup)
+{
+	if(_filterPopup == filterPopup)
+		return;
+
+	_filterPopup = filterPopup;
+	if(_filterPopup) {
+		if(!isEditable()) {
+			_filterOnly = true;
+			setEditable(true);
+			connect(lineEdit(), &QLineEdit::editingFinished,
+					this, &SelectComboBox::restoreText);
 		}
+		// the shared model is read only, so typed text must never be inserted
+		setInsertPolicy(QComboBox::NoInsert);
+
+		auto filterCompleter = new QCompleter{model(), this};
+		filterCompleter->setCaseSensitivity(Qt::CaseInsensitive);
+		filterCompleter->setFilterMode(Qt::MatchContains);
+		filterCompleter->setCompletionMode(QCompleter::PopupCompletion);
+		auto popup = qobject_cast<QListView*>(filterCompleter->popup());
+		if(popup)
+			popup->setUniformItemSizes(true);
+		setCompleter(filterCompleter);
+	} else if(_filterOnly) {
+		_filterOnly = false;
+		setEditable(false);
+	} else {
+		auto defaultCompleter = new QCompleter{model(), this};
+		defaultCompleter->setCaseSensitivity(Qt::CaseInsensitive);
+		setCompleter(defaultCompleter);
 	}
-	emit listElementsChanged(listElements);
+	emit filterPopupChanged(_filterPopup);
+}
+
+void SelectComboBox::restoreText()
+{
+	if(_filterOnly && currentText() != itemText(currentIndex()))
+		setEditText(itemText(currentIndex()));
+}
+
+
+
+QSharedPointer<SelectListModel> SelectListModel::shared(const QVariantList &listElements)
+{
+	// only gui thread access, so no locking required
+	static QList<QWeakPointer<SelectListModel>> models;
+	static const int MaxShared = 16;
+
+	for(auto it = models.begin(); it != models.end();) {
+		auto model = it->toStrongRef();
+		if(!model)
+			it = models.erase(it);
+		else if(model->listElements() == listElements) // cheap for implicitly shared copies of the same list
+			return model;
+		else
+			++it;
+	}
+
+	QSharedPointer<SelectListModel> model{new SelectListModel{listElements}, &QObject::deleteLater};
+	models.append(model);
+	if(models.size() > MaxShared)
+		models.removeFirst();
+	return model;
+}
+
+SelectListModel::SelectListModel(const QVariantList &listElements, QObject *parent) :
+	QAbstractListModel{parent},
+	_elements{listElements}
+{}
+
+QVariantList SelectListModel::listElements() const
+{
+	return _elements.listElements();
+}
+
+int SelectListModel::findValue(const QVariant &value) const
+{
+	return _elements.indexOf(value);
 }
 
+int SelectListModel::rowCount(const QModelIndex &parent) const
+{
+	if(parent.isValid())
+		return 0;
+	else
+		return _elements.size();
+}
+
+QVariant SelectListModel::data(const QModelIndex &index, int role) const
+{
+	if(!checkIndex(index, CheckIndexOption::IndexIsValid | CheckIndexOption::ParentIsInvalid))
+		return {};
+
+	switch(role) {
+	case Qt::DisplayRole:
+	case Qt::EditRole:
+		return _elements.at(index.row()).name;
+	case Qt::UserRole:
+		return _elements.at(index.row()).value;
+	default:
+		return {};
+	}
+}
+
+Qt::ItemFlags SelectListModel::flags(const QModelIndex &index) const
+{
+	if(!index.isValid())
+		return Qt::NoItemFlags;
+	return Qt::ItemIsSelectable | Qt::ItemIsEnabled | Qt::ItemNeverHasChildren;
+}
@@ -2,33 +2,71 @@
 #define QTMVVM_SELECTCOMBOBOX_P_H
 
 #include <QtCore/QVariant>
+#include <QtCore/QAbstractListModel>
+#include <QtCore/QSharedPointer>
 
 #include <QtWidgets/QComboBox>
 
+#include <QtMvvmCore/private/listelements_p.h>
+
 #include "qtmvvmwidgets_global.h"
 
 namespace QtMvvm {
 
-class SelectComboBox : public QComboBox
+// read only model of list elements. Models are shared between all boxes with the same elements
+class Q_MVVMWIDGETS_EXPORT SelectListModel : public QAbstractListModel
+{
+	Q_OBJECT
+
+public:
+	static QSharedPointer<SelectListModel> shared(const QVariantList &listElements);
+
+	explicit SelectListModel(const QVariantList &listElements, QObject *parent = nullptr);
+
+	QVariantList listElements() const;
+	int findValue(const QVariant &value) const;
+
+	int rowCount(const QModelIndex &parent = {}) const override;
+	QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const override;
+	Qt::ItemFlags flags(const QModelIndex &index) const override;
+
+private:
+	ListElements _elements;
+};
+
+class Q_MVVMWIDGETS_EXPORT SelectComboBox : public QComboBox
 {
 	Q_OBJECT
 
 	Q_PROPERTY(QVariant currentValue READ currentValue WRITE setCurrentValue NOTIFY currentValueChanged USER true)
 	Q_PROPERTY(QVariantList listElements READ listElements WRITE setListElements NOTIFY listElementsChanged)
+	Q_PROPERTY(bool filterPopup READ hasFilterPopup WRITE setFilterPopup NOTIFY filterPopupChanged)
 
 public:
 	explicit SelectComboBox(QWidget *parent = nullptr);
 
 	QVariant currentValue() const;
 	QVariantList listElements() const;
+	bool hasFilterPopup() const;
 
 public Q_SLOTS:
 	void setCurrentValue(const QVariant &data);
 	void setListElements(const QVariantList &listElements);
+	void setFilterPopup(bool filterPopup);
 
 Q_SIGNALS:
 	void currentValueChanged();
 	void listElementsChanged(const QVariantList &listElements);
+	void filterPopupChanged(bool filterPopup);
+
+private Q_SLOTS:
+	void restoreText();
+
+private:
+	QSharedPointer<SelectListModel> _model;
+	bool _filterPopup = false;
+	// editable only to type a filter, not to enter custom values
+	bool _filterOnly = false;
 };
 
 }
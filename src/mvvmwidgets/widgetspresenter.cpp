@@ -20,9 +20,15 @@
 #include <QtWidgets/QFileDialog>
 #include <QtWidgets/QLabel>
 #include <QtWidgets/QColorDialog>
+#include <QtWidgets/QStatusBar>
+#include <QtWidgets/QToolTip>
+
+#include <QtGui/QCursor>
 
 #include <QtMvvmCore/CoreApp>
 #include <QtMvvmCore/exception.h>
+#include <QtMvvmCore/FlightRecorder>
+#include <QtMvvmCore/StallDetector>
 #include <QtMvvmCore/private/qtmvvm_logging_p.h>
 
 #include <dialogmaster.h>
@@ -58,15 +64,30 @@ WidgetsPresenter::~WidgetsPresenter() = default;
 
 void WidgetsPresenter::registerView(const QMetaObject *viewType)
 {
-	Q_ASSERT_X(viewType->inherits(&QWidget::staticMetaObject), Q_FUNC_INFO, "viewType must be a QWidget class");
-	WidgetsPresenterPrivate::currentPresenter()->d->implicitMappings.insert(viewType);
+	registerViewImpl(nullptr, viewType, nullptr);
 }
 
 void WidgetsPresenter::registerViewExplicitly(const QMetaObject *viewModelType, const QMetaObject *viewType)
 {
-	Q_ASSERT_X(viewModelType->inherits(&ViewModel::staticMetaObject), Q_FUNC_INFO, "viewModelType must be a QtMvvm::ViewModel class");
+	Q_ASSERT_X(viewModelType, Q_FUNC_INFO, "viewModelType must not be null");
+	registerViewImpl(viewModelType, viewType, nullptr);
+}
+
+void WidgetsPresenter::registerViewImpl(const QMetaObject *viewModelType, const QMetaObject *viewType, ViewConstructor constructor)
+{
+	Q_ASSERT_X(!viewModelType || viewModelType->inherits(&ViewModel::staticMetaObject), Q_FUNC_INFO, "viewModelType must be a QtMvvm::ViewModel class");
 	Q_ASSERT_X(viewType->inherits(&QWidget::staticMetaObject), Q_FUNC_INFO, "viewType must be a QWidget class");
-	WidgetsPresenterPrivate::currentPresenter()->d->explicitMappings.insert(viewModelType, viewType);
+	// views registered via their metaobject only are checked now instead of when presenting them
+	if(!constructor && !WidgetsPresenterPrivate::hasViewConstructor(viewType))
+		throw PresenterException(WidgetsPresenterPrivate::missingConstructorError(viewType));
+
+	auto d = WidgetsPresenterPrivate::currentPresenter()->d.data();
+	if(viewModelType)
+		d->explicitMappings.insert(viewModelType, viewType);
+	else
+		d->implicitMappings.insert(viewType);
+	if(constructor)
+		d->viewConstructors.insert(viewType, constructor);
 }
 
 InputWidgetFactory *WidgetsPresenter::getInputWidgetFactory()
@@ -76,6 +97,7 @@ InputWidgetFactory *WidgetsPresenter::getInputWidgetFactory()
 
 void WidgetsPresenter::present(ViewModel *viewModel, const QVariantHash &params, QPointer<ViewModel> parent)
 {
+	StallDetector::Scope stallScope{StallDetector::ViewCreation, viewModel->metaObject()->className()};
 	// find and create view
 	auto viewMetaObject = findWidgetMetaObject(viewModel->metaObject());
 	if(!viewMetaObject)
@@ -84,14 +106,11 @@ void WidgetsPresenter::present(ViewModel *viewModel, const QVariantHash &params,
 	auto parentView = parent ?
 						  qobject_cast<QWidget*>(parent->parent()) :
 						  nullptr;
-	auto view = qobject_cast<QWidget*>(viewMetaObject->newInstance(Q_ARG(QtMvvm::ViewModel*, viewModel),
-																   Q_ARG(QWidget*, parentView)));
-	if(!view) {
-		throw PresenterException(QByteArrayLiteral("Failed to create view of type \"") +
-								 viewMetaObject->className() +
-								 QByteArrayLiteral("\" (did you mark the constructor as Q_INVOKABLE? "
-												   "Required signature: \"Q_INVOKABLE Contructor(QtMvvm::ViewModel *, QWidget*);\")"));
-	}
+	auto view = d->createView(viewMetaObject, viewModel, parentView);
+	if(!view)
+		throw PresenterException(WidgetsPresenterPrivate::missingConstructorError(viewMetaObject));
+
+	FlightRecorder::record(FlightRecorder::ViewCreated, viewMetaObject);
 
 	// initialize viewmodel and view relationship
 	viewModel->setParent(view);
@@ -121,6 +140,8 @@ void WidgetsPresenter::showDialog(const MessageConfig &config, MessageResult *re
 		presentColorDialog(config, result);
 	else if(config.type() == MessageConfig::TypeProgressDialog)
 		presentProgressDialog(config, result);
+	else if(config.type() == MessageConfig::TypeNotification)
+		presentNotification(config, result);
 	else
 		presentOtherDialog(config, result);
 	logDebug() << "Presented dialog of type" << config.type();
@@ -263,8 +284,8 @@ void WidgetsPresenter::presentMessageBox(const MessageConfig &config, QPointer<M
 		auto mIcon = QGuiApplication::windowIcon();
 		if(!mIcon.isNull())
 			info.icon = mIcon;
-		qtHelp = config.viewProperties().value(QStringLiteral("addQtVersion"), true).toBool();
-		qtHelp = config.viewProperties().value(QStringLiteral("showQtHelp"), qtHelp).toBool();
+		qtHelp = config.viewProperty<bool>(MessageConfig::AddQtVersionProperty, true);
+		qtHelp = config.viewProperty<bool>(MessageConfig::ShowQtHelpProperty, qtHelp);
 	}
 
 	info.escapeButton = QMessageBox::NoButton; //use no button for non button closes
@@ -281,19 +302,13 @@ void WidgetsPresenter::presentMessageBox(const MessageConfig &config, QPointer<M
 
 	//special properties
 	QSharedPointer<bool> checked;
-	auto props = config.viewProperties();
-	info.parent = WidgetsPresenterPrivate::parent(props);
-	if(props.contains(QStringLiteral("windowTitle")))
-		info.windowTitle = props.value(QStringLiteral("windowTitle")).toString();
-	if(props.contains(QStringLiteral("details")))
-		info.details = props.value(QStringLiteral("details")).toString();
-	if(props.contains(QStringLiteral("checkable"))) {
-		if(props.value(QStringLiteral("checkable")).toBool()) {
-			checked = QSharedPointer<bool>::create(config.defaultValue().toBool());
-			info.checked = checked.data();
-			if(props.contains(QStringLiteral("checkString")))
-				info.checkString = props.value(QStringLiteral("checkString")).toString();
-		}
+	info.parent = WidgetsPresenterPrivate::parent(config);
+	info.windowTitle = config.viewProperty<QString>(MessageConfig::WindowTitleProperty, info.windowTitle);
+	info.details = config.viewProperty<QString>(MessageConfig::DetailsProperty, info.details);
+	if(config.viewProperty<bool>(MessageConfig::CheckableProperty, false)) {
+		checked = QSharedPointer<bool>::create(config.defaultValue().toBool());
+		info.checked = checked.data();
+		info.checkString = config.viewProperty<QString>(MessageConfig::CheckStringProperty, info.checkString);
 	}
 
 	//create and show the msgbox
@@ -317,7 +332,7 @@ void WidgetsPresenter::presentMessageBox(const MessageConfig &config, QPointer<M
 void WidgetsPresenter::presentInputDialog(const MessageConfig &config, QPointer<MessageResult> result)
 {
 	auto input = d->inputViewFactory->createInput(config.subType(), nullptr, config.viewProperties());
-	auto dialog = new QDialog{WidgetsPresenterPrivate::parent(config.viewProperties())};
+	auto dialog = new QDialog{WidgetsPresenterPrivate::parent(config)};
 	dialog->setAttribute(Qt::WA_DeleteOnClose);
 	result->setCloseTarget(dialog, QStringLiteral("reject()"));
 	auto layout = new QVBoxLayout(dialog);
@@ -373,7 +388,7 @@ void WidgetsPresenter::presentInputDialog(const MessageConfig &config, QPointer<
 void WidgetsPresenter::presentFileDialog(const MessageConfig &config, QPointer<MessageResult> result)
 {
 	auto props = config.viewProperties();
-	auto dialog = new QFileDialog{WidgetsPresenterPrivate::parent(props)};
+	auto dialog = new QFileDialog{WidgetsPresenterPrivate::parent(config)};
 	dialog->setAttribute(Qt::WA_DeleteOnClose);
 	result->setCloseTarget(dialog, QStringLiteral("reject()"));
 
@@ -430,7 +445,7 @@ void WidgetsPresenter::presentFileDialog(const MessageConfig &config, QPointer<M
 void WidgetsPresenter::presentColorDialog(const MessageConfig &config, const QPointer<MessageResult> &result)
 {
 	auto props = config.viewProperties();
-	auto dialog = new QColorDialog{WidgetsPresenterPrivate::parent(props)};
+	auto dialog = new QColorDialog{WidgetsPresenterPrivate::parent(config)};
 	dialog->setAttribute(Qt::WA_DeleteOnClose);
 	result->setCloseTarget(dialog, QStringLiteral("reject()"));
 
@@ -477,13 +492,40 @@ void WidgetsPresenter::presentProgressDialog(const MessageConfig &config, const
 		logWarning() << "ProgressControl was destroyed before a progress dialog could be shown";
 		return;
 	}
-	auto props = config.viewProperties();
-	auto dialog = new ProgressDialog{config, result, control, WidgetsPresenterPrivate::parent(props)};
+	auto dialog = new ProgressDialog{config, result, control, WidgetsPresenterPrivate::parent(config)};
 	dialog->setAttribute(Qt::WA_DeleteOnClose);
 	result->setCloseTarget(dialog, QStringLiteral("reject()"));
 	dialog->open();
 }
 
+void WidgetsPresenter::presentNotification(const MessageConfig &config, const QPointer<MessageResult> &result)
+{
+	auto text = config.title().isEmpty() ?
+					config.text() :
+					tr("%1: %2").arg(config.title(), config.text());
+	auto repeatCount = config.viewProperty<int>(MessageConfig::RepeatCountProperty, 1);
+	if(repeatCount > 1)
+		text = tr("%1 (x%L2)").arg(text).arg(repeatCount);
+	auto timeout = config.viewProperty(QStringLiteral("timeout"), 3000).toInt();
+
+	//prefer an existing status bar of the active main window, fall back to a tooltip
+	auto window = QApplication::activeWindow();
+	auto statusBar = window ?
+						 window->findChild<QStatusBar*>(QString{}, Qt::FindDirectChildrenOnly) :
+						 nullptr;
+	if(statusBar && qobject_cast<QMainWindow*>(window))
+		statusBar->showMessage(text, timeout);
+	else if(window) {
+		QToolTip::showText(window->mapToGlobal(QPoint{window->width() / 2, window->height()}),
+						   text, window, {}, timeout);
+	} else
+		QToolTip::showText(QCursor::pos(), text, nullptr, {}, timeout);
+
+	//notifications cannot be answered, so they are done as soon as they are shown
+	if(result)
+		result->complete(MessageConfig::NoButton);
+}
+
 void WidgetsPresenter::presentOtherDialog(const MessageConfig &config, QPointer<MessageResult> result)
 {
 	Q_UNUSED(result)
@@ -494,7 +536,8 @@ void WidgetsPresenter::presentOtherDialog(const MessageConfig &config, QPointer<
 // ------------- Private Implementation -------------
 
 WidgetsPresenterPrivate::WidgetsPresenterPrivate() :
-	implicitMappings{&SettingsDialog::staticMetaObject}
+	implicitMappings{&SettingsDialog::staticMetaObject},
+	viewConstructors{{&SettingsDialog::staticMetaObject, &WidgetsPresenter::constructView<SettingsDialog>}}
 {}
 
 WidgetsPresenter *WidgetsPresenterPrivate::currentPresenter()
@@ -511,9 +554,38 @@ WidgetsPresenter *WidgetsPresenterPrivate::currentPresenter()
 	}
 }
 
-QWidget *WidgetsPresenterPrivate::parent(const QVariantMap &properties)
+QWidget *WidgetsPresenterPrivate::createView(const QMetaObject *viewType, ViewModel *viewModel, QWidget *parentView) const
+{
+	auto constructor = viewConstructors.value(viewType);
+	if(constructor)
+		return constructor(viewModel, parentView);
+	else {
+		return qobject_cast<QWidget*>(viewType->newInstance(Q_ARG(QtMvvm::ViewModel*, viewModel),
+															Q_ARG(QWidget*, parentView)));
+	}
+}
+
+bool WidgetsPresenterPrivate::hasViewConstructor(const QMetaObject *viewType)
+{
+	// same lookup as QMetaObject::newInstance
+	QByteArray className = viewType->className();
+	auto nsIndex = className.lastIndexOf(':');
+	if(nsIndex != -1)
+		className = className.mid(nsIndex + 1);
+	return viewType->indexOfConstructor(className + "(QtMvvm::ViewModel*,QWidget*)") != -1;
+}
+
+QByteArray WidgetsPresenterPrivate::missingConstructorError(const QMetaObject *viewType)
+{
+	return QByteArrayLiteral("Failed to create view of type \"") +
+			viewType->className() +
+			QByteArrayLiteral("\" (did you mark the constructor as Q_INVOKABLE? "
+							  "Required signature: \"Q_INVOKABLE Contructor(QtMvvm::ViewModel *, QWidget*);\")");
+}
+
+QWidget *WidgetsPresenterPrivate::parent(const MessageConfig &config)
 {
-	if(!properties.value(QStringLiteral("modal"), false).toBool())
+	if(!config.viewProperty<bool>(MessageConfig::ModalProperty, false))
 		return QApplication::activeWindow();
 	else
 		return nullptr;
@@ -82,11 +82,20 @@ protected:
 	void presentColorDialog(const MessageConfig &config, const QPointer<MessageResult> &result); //MAJOR make virtual
 	//! Called to present a dialog of MessageConfig::TypeProgressDialog
 	void presentProgressDialog(const MessageConfig &config, const QPointer<MessageResult> &result); //MAJOR make virtual
+	//! Called to present a notification of MessageConfig::TypeNotification
+	void presentNotification(const MessageConfig &config, const QPointer<MessageResult> &result); //MAJOR make virtual
 	//! Called to present a dialog of a non standard MessageConfig::type
 	virtual void presentOtherDialog(const MessageConfig &config, QPointer<MessageResult> result);
 
 private:
+	friend class QtMvvm::WidgetsPresenterPrivate;
 	QScopedPointer<WidgetsPresenterPrivate> d;
+
+	using ViewConstructor = QWidget*(*)(ViewModel*, QWidget*);
+
+	template <typename TView>
+	static QWidget *constructView(ViewModel *viewModel, QWidget *parent);
+	static void registerViewImpl(const QMetaObject *viewModelType, const QMetaObject *viewType, ViewConstructor constructor);
 };
 
 // ------------- Generic Implementation -------------
@@ -102,11 +111,7 @@ template<typename TView>
 void WidgetsPresenter::registerView()
 {
 	static_assert(std::is_base_of<QWidget, TView>::value, "TWidget must inherit QWidget!");
-	if(false) { //compile time check for the constructor
-		Q_UNREACHABLE();
-		Q_UNUSED(new TView(static_cast<ViewModel*>(nullptr), static_cast<QWidget*>(nullptr)))
-	}
-	registerView(&TView::staticMetaObject);
+	registerViewImpl(nullptr, &TView::staticMetaObject, &WidgetsPresenter::constructView<TView>);
 }
 
 template<typename TViewModel, typename TView>
@@ -114,11 +119,13 @@ void WidgetsPresenter::registerViewExplicitly()
 {
 	static_assert(std::is_base_of<QWidget, TView>::value, "TWidget must inherit QWidget!");
 	static_assert(std::is_base_of<ViewModel, TViewModel>::value, "TViewModel must inherit ViewModel!");
-	if(false) { //compile time check for the constructor
-		Q_UNREACHABLE();
-		Q_UNUSED(new TView(static_cast<ViewModel*>(nullptr), static_cast<QWidget*>(nullptr)))
-	}
-	registerViewExplicitly(&TViewModel::staticMetaObject, &TView::staticMetaObject);
+	registerViewImpl(&TViewModel::staticMetaObject, &TView::staticMetaObject, &WidgetsPresenter::constructView<TView>);
+}
+
+template<typename TView>
+QWidget *WidgetsPresenter::constructView(ViewModel *viewModel, QWidget *parent)
+{
+	return new TView(viewModel, parent);
 }
 
 }
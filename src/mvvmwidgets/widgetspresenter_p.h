@@ -22,8 +22,15 @@ public:
 	InputWidgetFactory* inputViewFactory = nullptr;
 	QSet<const QMetaObject*> implicitMappings;
 	QHash<const QMetaObject*, const QMetaObject*> explicitMappings;
+	// direct constructors of views registered via the templates, to skip the constructor search
+	QHash<const QMetaObject*, WidgetsPresenter::ViewConstructor> viewConstructors;
 
-	static QWidget *parent(const QVariantMap &properties);
+	QWidget *createView(const QMetaObject *viewType, ViewModel *viewModel, QWidget *parentView) const;
+
+	static bool hasViewConstructor(const QMetaObject *viewType);
+	static QByteArray missingConstructorError(const QMetaObject *viewType);
+
+	static QWidget *parent(const MessageConfig &config);
 };
 
 Q_MVVMWIDGETS_EXPORT QValidator *createUrlValidator(QStringList schemes, QObject* parent = nullptr);
@@ -4,6 +4,16 @@ SUBDIRS += cmake \
 	mvvmcore \
 	qml
 
+qtHaveModule(widgets) {
+	SUBDIRS += \
+		mvvmwidgets
+}
+
+qtHaveModule(quick) {
+	SUBDIRS += \
+		mvvmquick
+}
+
 qtHaveModule(datasync) {
 	SUBDIRS += \
 		mvvmdatasynccore
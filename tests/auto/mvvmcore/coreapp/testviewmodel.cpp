@@ -14,6 +14,12 @@ void TestViewModel::presentResult(quint32 code)
 	showForResult<TestViewModel>(code);
 }
 
+void TestViewModel::onInitParams(TestParams params)
+{
+	typedValue = *params.value;
+	typedNumber = params.number;
+}
+
 void TestViewModel::onInit(const QVariantHash &params)
 {
 }
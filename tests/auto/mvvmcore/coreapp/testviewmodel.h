@@ -1,8 +1,16 @@
 #ifndef TESTVIEWMODEL_H
 #define TESTVIEWMODEL_H
 
+#include <memory>
 #include <QtMvvmCore/ViewModel>
 
+// move-only on purpose, to verify typed parameters are never copied
+struct TestParams
+{
+	std::unique_ptr<QString> value;
+	int number = 0;
+};
+
 class TestViewModel : public QtMvvm::ViewModel
 {
 	Q_OBJECT
@@ -13,7 +21,11 @@ public:
 	void presenChild(const QVariantHash &params = {});
 	void presentResult(quint32 code);
 
+	void onInitParams(TestParams params);
+
 	QList<std::tuple<quint32, QVariant>> results;
+	QString typedValue;
+	int typedNumber = 0;
 
 public Q_SLOTS:
 	void onInit(const QVariantHash &params) override;
@@ -1,5 +1,9 @@
 #include <QtTest>
 #include <QtMvvmCore/ServiceRegistry>
+#include <QtMvvmCore/FlightRecorder>
+#include <QtMvvmCore/StallDetector>
+#include <QtMvvmCore/ViewModelTracker>
+#include <QtCore/QStringListModel>
 #include "testapp.h"
 #include "testviewmodel.h"
 using namespace QtMvvm;
@@ -22,12 +26,18 @@ private Q_SLOTS:
 
 	void testPresentVm();
 	void testPresentVmArgs();
+	void testPresentVmTypedArgs();
 	void testPresentVmChild();
 	void testPresentVmForResult();
 	void testPresentVmContainer();
 	void testPresentVmSingleton();
+	void testFlightRecorder();
+	void testStallDetector();
+	void testViewModelTracker();
 
 	void testPresentDialog();
+	void testDialogQueue();
+	void testNotificationQueue();
 	void testPresentMessage_data();
 	void testPresentMessage();
 
@@ -235,6 +245,29 @@ void CoreAppTest::testPresentVmArgs()
 	QVERIFY(!std::get<2>(presenter->presented[0]));
 }
 
+void CoreAppTest::testPresentVmTypedArgs()
+{
+	TestParams params;
+	params.value.reset(new QString{QStringLiteral("value")});
+	params.number = 42;
+
+	auto presenter = TestApp::presenter();
+	presenter->presented.clear();
+	QSignalSpy presentSpy{presenter, &TestPresenter::presentDone};
+	CoreApp::show<TestViewModel>(std::move(params));
+
+	QVERIFY(presentSpy.wait());
+	QCOMPARE(presentSpy.size(), 1);
+	QCOMPARE(presenter->presented.size(), 1);
+
+	auto vm = qobject_cast<TestViewModel*>(std::get<0>(presenter->presented[0]));
+	QVERIFY(vm);
+	QCOMPARE(vm->typedValue, QStringLiteral("value"));
+	QCOMPARE(vm->typedNumber, 42);
+	QVERIFY(std::get<1>(presenter->presented[0]).isEmpty());
+	QVERIFY(!std::get<2>(presenter->presented[0]));
+}
+
 void CoreAppTest::testPresentVmChild()
 {
 	QVariantHash params {
@@ -313,6 +346,17 @@ void CoreAppTest::testPresentVmForResult()
 	QCOMPARE(vm->results.size(), 2);
 	QCOMPARE(std::get<0>(vm->results[1]), 24u);
 	QVERIFY(!std::get<1>(vm->results[1]).isValid());
+
+	// requesting viewmodel destroyed before the queued show is processed
+	vm->presentResult(66);
+	delete vm;
+	QVERIFY(presentSpy.wait());
+	QCOMPARE(presentSpy.size(), 4);
+	child = std::get<0>(presenter->presented[3]);
+	QVERIFY(child);
+	QVERIFY(!std::get<2>(presenter->presented[3]));
+	emit child->resultReady(1);
+	delete child;
 }
 
 void CoreAppTest::testPresentVmContainer()
@@ -391,6 +435,144 @@ void CoreAppTest::testPresentVmSingleton()
 	QCOMPARE(instSpy.size(), 2);
 }
 
+void CoreAppTest::testFlightRecorder()
+{
+	FlightRecorder::clear();
+	auto presenter = TestApp::presenter();
+	presenter->presented.clear();
+	QSignalSpy presentSpy{presenter, &TestPresenter::presentDone};
+	CoreApp::show<TestViewModel>();
+	QVERIFY(presentSpy.wait());
+
+	auto events = FlightRecorder::events();
+	QCOMPARE(events.size(), 3);
+	QCOMPARE(events[0].type, FlightRecorder::ShowRequested);
+	QCOMPARE(events[0].metaObject, &TestViewModel::staticMetaObject);
+	QCOMPARE(events[1].type, FlightRecorder::ViewModelConstructed);
+	QCOMPARE(events[1].metaObject, &TestViewModel::staticMetaObject);
+	QCOMPARE(events[2].type, FlightRecorder::Presented);
+	QCOMPARE(events[2].metaObject, &TestViewModel::staticMetaObject);
+	QVERIFY(events[0].timestamp <= events[1].timestamp);
+	QVERIFY(events[1].timestamp <= events[2].timestamp);
+
+	QBuffer buffer;
+	QVERIFY(buffer.open(QIODevice::WriteOnly));
+	QVERIFY(FlightRecorder::dump(&buffer));
+	QVERIFY(buffer.data().contains("Presented  TestViewModel"));
+
+	// the buffer wraps around and only keeps the newest events
+	FlightRecorder::setCapacity(4);
+	QCOMPARE(FlightRecorder::capacity(), 4);
+	for(quint32 i = 0; i < 10; i++)
+		FlightRecorder::record(FlightRecorder::UserEvent, nullptr, i);
+	events = FlightRecorder::events();
+	QCOMPARE(events.size(), 4);
+	QCOMPARE(events.first().value, 6u);
+	QCOMPARE(events.last().value, 9u);
+
+	FlightRecorder::setEnabled(false);
+	FlightRecorder::record(FlightRecorder::UserEvent, nullptr, 10);
+	QCOMPARE(FlightRecorder::events().last().value, 9u);
+	FlightRecorder::setEnabled(true);
+	FlightRecorder::setCapacity(4096);
+}
+
+void CoreAppTest::testStallDetector()
+{
+	StallDetector::clearReports();
+	// the threshold is far above the idle wait, so a loaded machine does not report the idle phase as a stall
+	StallDetector::start(1000);
+	QVERIFY(StallDetector::isRunning());
+	QCOMPARE(StallDetector::threshold(), 1000);
+
+	// scopes outside of a stall are not reported
+	{
+		StallDetector::Scope scope{StallDetector::UserScope, "idle"};
+	}
+	QTest::qWait(100);
+	QVERIFY(StallDetector::reports().isEmpty());
+
+	{
+		StallDetector::Scope outer{StallDetector::ShowViewModel, "TestViewModel"};
+		StallDetector::Scope inner{StallDetector::UserScope, "blocking"};
+		QThread::msleep(1500);
+	}
+	QTRY_COMPARE(StallDetector::reports().size(), 1);
+	StallDetector::stop();
+	QVERIFY(!StallDetector::isRunning());
+
+	auto report = StallDetector::reports().first();
+	QVERIFY(report.duration >= 1000000000ll);
+	QCOMPARE(report.scopes.size(), 2);
+	QCOMPARE(report.scopes[0].type, StallDetector::ShowViewModel);
+	QCOMPARE(report.scopes[0].detail, QByteArray{"TestViewModel"});
+	QCOMPARE(report.scopes[1].type, StallDetector::UserScope);
+	QCOMPARE(report.scopes[1].detail, QByteArray{"blocking"});
+	QVERIFY(report.scopes[0].duration >= report.scopes[1].duration);
+
+	QBuffer buffer;
+	QVERIFY(buffer.open(QIODevice::WriteOnly));
+	QVERIFY(StallDetector::dump(&buffer));
+	QVERIFY(buffer.data().contains("UserScope  blocking"));
+	StallDetector::clearReports();
+}
+
+void CoreAppTest::testViewModelTracker()
+{
+	auto baseCount = ViewModelTracker::liveCount();
+	QScopedPointer<TestViewModel> vm{new TestViewModel{}};
+	QCOMPARE(ViewModelTracker::liveCount(), baseCount + 1);
+
+	auto model = new QStringListModel{{QStringLiteral("a"), QStringLiteral("b")}, vm.data()};
+	new QObject{model};
+
+	auto presenter = TestApp::presenter();
+	presenter->presented.clear();
+	QSignalSpy presentSpy{presenter, &TestPresenter::presentDone};
+	vm->presentResult(42);
+	QVERIFY(presentSpy.wait());
+	QCOMPARE(presenter->presented.size(), 1);
+	auto child = std::get<0>(presenter->presented[0]);
+	QVERIFY(child);
+
+	auto found = false;
+	for(const auto &instance : ViewModelTracker::instances()) {
+		if(instance.viewModel != vm.data())
+			continue;
+		found = true;
+		QCOMPARE(instance.metaObject, &TestViewModel::staticMetaObject);
+		QCOMPARE(instance.childObjects, 2);
+		QCOMPARE(instance.modelRows, 2);
+		QCOMPARE(instance.pendingResults, 1);
+		QVERIFY(!instance.singleton);
+		QVERIFY(instance.parentChain.isEmpty());
+	}
+	QVERIFY(found);
+
+	auto summary = ViewModelTracker::summary();
+	auto typeIt = std::find_if(summary.begin(), summary.end(), [](const ViewModelTracker::TypeSummary &type) {
+		return type.metaObject == &TestViewModel::staticMetaObject;
+	});
+	QVERIFY(typeIt != summary.end());
+	QVERIFY(typeIt->count >= 2);
+
+	// delivering the result releases the pending result
+	emit child->resultReady(24);
+	for(const auto &instance : ViewModelTracker::instances()) {
+		if(instance.viewModel == vm.data())
+			QCOMPARE(instance.pendingResults, 0);
+	}
+
+	QBuffer buffer;
+	QVERIFY(buffer.open(QIODevice::WriteOnly));
+	QVERIFY(ViewModelTracker::dump(&buffer));
+	QVERIFY(buffer.data().contains("TestViewModel: count="));
+
+	vm.reset();
+	delete child;
+	QCOMPARE(ViewModelTracker::liveCount(), baseCount);
+}
+
 void CoreAppTest::testPresentDialog()
 {
 	auto presenter = TestApp::presenter();
@@ -430,6 +612,16 @@ void CoreAppTest::testPresentDialog()
 		{QStringLiteral("test"), QStringLiteral("tset")}
 	};
 	QCOMPARE(conf.viewProperties(), viewProps);
+	QCOMPARE(conf.buttonText(MessageConfig::Help), QStringLiteral("hell"));
+	QVERIFY(conf.buttonText(MessageConfig::Ok).isNull());
+	QVERIFY(conf.hasViewProperty(QStringLiteral("test")));
+	QCOMPARE(conf.viewProperty(QStringLiteral("test")), QStringLiteral("tset"));
+	QVERIFY(!conf.viewProperty(MessageConfig::ModalProperty).isValid());
+	QCOMPARE(conf.viewProperty<bool>(MessageConfig::ModalProperty, true), true);
+	conf.setViewProperty(QStringLiteral("modal"), false);
+	QCOMPARE(conf.viewProperty<bool>(MessageConfig::ModalProperty, true), false);
+	conf.setViewProperties(viewProps);
+	QVERIFY(!conf.viewProperty(MessageConfig::ModalProperty).isValid());
 
 	// test result
 	result->setAutoDelete(false);
@@ -450,6 +642,104 @@ void CoreAppTest::testPresentDialog()
 	result->deleteLater();
 }
 
+void CoreAppTest::testDialogQueue()
+{
+	auto presenter = TestApp::presenter();
+	presenter->dialogs.clear();
+	QSignalSpy presentSpy{presenter, &TestPresenter::dialogDone};
+
+	// merge identical pending dialogs
+	CoreApp::setDialogDeduplication(CoreApp::DeduplicateAll);
+	QList<QPointer<MessageResult>> results;
+	for(auto i = 0; i < 3; i++)
+		results.append(critical(QStringLiteral("title"), QStringLiteral("text")));
+	results.append(critical(QStringLiteral("title"), QStringLiteral("other")));
+	QSignalSpy mergedSpy1{results[1].data(), &MessageResult::dialogDone};
+	QSignalSpy mergedSpy2{results[2].data(), &MessageResult::dialogDone};
+
+	while(presentSpy.size() < 2)
+		QVERIFY(presentSpy.wait());
+	QVERIFY(!presentSpy.wait(500));
+	QCOMPARE(presenter->dialogs.size(), 2);
+	QCOMPARE(std::get<0>(presenter->dialogs[0]).text(), QStringLiteral("text"));
+	QCOMPARE(std::get<1>(presenter->dialogs[0]), results[0].data());
+	QCOMPARE(std::get<0>(presenter->dialogs[1]).text(), QStringLiteral("other"));
+	QCOMPARE(std::get<1>(presenter->dialogs[1]), results[3].data());
+
+	std::get<1>(presenter->dialogs[0])->complete(MessageConfig::Ok);
+	if(mergedSpy2.isEmpty())
+		QVERIFY(mergedSpy2.wait());
+	QCOMPARE(mergedSpy1.size(), 1);
+	QCOMPARE(mergedSpy1.takeFirst()[0].toInt(), MessageConfig::Ok);
+	QCOMPARE(mergedSpy2.size(), 1);
+	QCOMPARE(mergedSpy2.takeFirst()[0].toInt(), MessageConfig::Ok);
+	// auto deleting results, merged ones included, are really deleted
+	QTRY_VERIFY(!results[0]);
+	QTRY_VERIFY(!results[1]);
+	QTRY_VERIFY(!results[2]);
+	std::get<1>(presenter->dialogs[1])->complete(MessageConfig::Ok);
+	CoreApp::setDialogDeduplication(CoreApp::DeduplicateNone);
+
+	// limit concurrent dialogs
+	presenter->dialogs.clear();
+	presentSpy.clear();
+	CoreApp::setMaxConcurrentDialogs(1);
+	information(QStringLiteral("title"), QStringLiteral("first"));
+	information(QStringLiteral("title"), QStringLiteral("second"));
+
+	QVERIFY(presentSpy.wait());
+	QVERIFY(!presentSpy.wait(500));
+	QCOMPARE(presenter->dialogs.size(), 1);
+	QCOMPARE(std::get<0>(presenter->dialogs[0]).text(), QStringLiteral("first"));
+
+	std::get<1>(presenter->dialogs[0])->complete(MessageConfig::Ok);
+	QVERIFY(presentSpy.wait());
+	QCOMPARE(presenter->dialogs.size(), 2);
+	QCOMPARE(std::get<0>(presenter->dialogs[1]).text(), QStringLiteral("second"));
+	std::get<1>(presenter->dialogs[1])->complete(MessageConfig::Ok);
+	CoreApp::setMaxConcurrentDialogs(0);
+}
+
+void CoreAppTest::testNotificationQueue()
+{
+	auto presenter = TestApp::presenter();
+	presenter->dialogs.clear();
+	QSignalSpy presentSpy{presenter, &TestPresenter::dialogDone};
+
+	CoreApp::setNotificationBufferSize(2);
+	CoreApp::setNotificationRateLimit(200);
+	notify(QStringLiteral("dropped"));
+	for(auto i = 0; i < 5; i++)
+		notify(QStringLiteral("repeated"), MessageConfig::SubTypeWarning);
+	notify(QStringLiteral("last"));
+
+	QVERIFY(presentSpy.wait());
+	QElapsedTimer timer;
+	timer.start();
+	QCOMPARE(presenter->dialogs.size(), 1);
+	auto config = std::get<0>(presenter->dialogs[0]);
+	QCOMPARE(config.type(), MessageConfig::TypeNotification);
+	QCOMPARE(config.subType(), MessageConfig::SubTypeWarning);
+	QCOMPARE(config.buttons(), MessageConfig::NoButton);
+	QCOMPARE(config.text(), QStringLiteral("repeated"));
+	QCOMPARE(config.viewProperty<int>(MessageConfig::RepeatCountProperty, 1), 5);
+	std::get<1>(presenter->dialogs[0])->complete(MessageConfig::NoButton);
+
+	// the second one is rate limited
+	QVERIFY(presentSpy.wait());
+	QVERIFY(timer.elapsed() >= 150);
+	QCOMPARE(presenter->dialogs.size(), 2);
+	config = std::get<0>(presenter->dialogs[1]);
+	QCOMPARE(config.subType(), MessageConfig::SubTypeInformation);
+	QCOMPARE(config.text(), QStringLiteral("last"));
+	QVERIFY(!config.hasViewProperty(QStringLiteral("repeatCount")));
+	std::get<1>(presenter->dialogs[1])->complete(MessageConfig::NoButton);
+	QVERIFY(!presentSpy.wait(500));
+
+	CoreApp::setNotificationBufferSize(32);
+	CoreApp::setNotificationRateLimit(250);
+}
+
 void CoreAppTest::testPresentMessage_data()
 {
 	QTest::addColumn<MsgFn>("messageFn");
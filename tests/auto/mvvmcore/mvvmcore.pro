@@ -6,6 +6,7 @@ SUBDIRS += \
 	serviceregistrytestplugin \
 	binding \
 	qsettingsaccessor \
+	snapshotsettingsaccessor \
 	settingsconfigloader \
 	coreapp
 
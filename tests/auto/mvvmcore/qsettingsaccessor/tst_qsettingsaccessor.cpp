@@ -17,6 +17,8 @@ private Q_SLOTS:
 	void initTestCase();
 	void cleanupTestCase();
 
+	void testWatchChanges();
+
 private:
 	QTemporaryFile *tempFile;
 };
@@ -51,6 +53,48 @@ void QSettingsAccessorTest::cleanupTestCase()
 	delete tempFile;
 }
 
+void QSettingsAccessorTest::testWatchChanges()
+{
+	auto writer = static_cast<QSettingsAccessor*>(createFirst());
+	writer->save(QStringLiteral("watch/unchanged"), 1);
+	writer->save(QStringLiteral("watch/removed"), 2);
+	writer->sync();
+
+	auto watcher = static_cast<QSettingsAccessor*>(createSecond());
+	QVERIFY(!watcher->watchChanges());
+	watcher->setWatchChanges(true);
+	QVERIFY(watcher->watchChanges());
+
+	QSignalSpy changedSpy{watcher, &ISettingsAccessor::entryChanged};
+	QSignalSpy removedSpy{watcher, &ISettingsAccessor::entryRemoved};
+	writer->save(QStringLiteral("watch/changed"), 3);
+	writer->remove(QStringLiteral("watch/removed"));
+	writer->sync();
+
+	QVERIFY(changedSpy.wait());
+	if(removedSpy.isEmpty())
+		QVERIFY(removedSpy.wait());
+	// only the keys that actually changed are reported
+	QCOMPARE(changedSpy.size(), 1);
+	QCOMPARE(changedSpy[0][0].toString(), QStringLiteral("watch/changed"));
+	QCOMPARE(changedSpy[0][1].toInt(), 3);
+	QCOMPARE(removedSpy.size(), 1);
+	QCOMPARE(removedSpy[0][0].toString(), QStringLiteral("watch/removed"));
+	QCOMPARE(watcher->load(QStringLiteral("watch/changed"), 0).toInt(), 3);
+
+	// own changes are not reported twice
+	changedSpy.clear();
+	watcher->save(QStringLiteral("watch/own"), 4);
+	watcher->sync();
+	QCOMPARE(changedSpy.size(), 1);
+	QVERIFY(!changedSpy.wait(500));
+
+	watcher->setWatchChanges(false);
+	QVERIFY(!watcher->watchChanges());
+	writer->deleteLater();
+	watcher->deleteLater();
+}
+
 QTEST_MAIN(QSettingsAccessorTest)
 
 #include "tst_qsettingsaccessor.moc"
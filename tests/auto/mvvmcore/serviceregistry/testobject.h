@@ -3,6 +3,9 @@
 
 #include <QtCore/QObject>
 #include <QtCore/QSharedPointer>
+#include <QtCore/QMutex>
+#include <QtCore/QSemaphore>
+#include <QtCore/QStringList>
 #include <QtMvvmCore/Injection>
 
 #define CREATE_TEST_OBJECT(index, ...) \
@@ -33,6 +36,44 @@
 	DESTROYER \
 	inline ~TestObject ## index() { Q_ASSERT_X(false, Q_FUNC_INFO, "destructor of never-destroy-object called"); }
 
+// records the shutdown hooks and destructors of test objects, which may be called from different threads
+class ShutdownLog
+{
+public:
+	static void append(const QString &entry) {
+		QMutexLocker _(&mutex());
+		entries().append(entry);
+	}
+
+	static QStringList &entries() {
+		static QStringList entries;
+		return entries;
+	}
+
+	// blocks hanging shutdown hooks until released
+	static QSemaphore &hang() {
+		static QSemaphore semaphore;
+		return semaphore;
+	}
+
+private:
+	static QMutex &mutex() {
+		static QMutex mutex;
+		return mutex;
+	}
+};
+
+#define SHUTDOWN_HOOK(index) \
+	Q_INVOKABLE inline void qtmvvm_aboutToDestroy() { ShutdownLog::append(QStringLiteral("hook%1").arg(index)); } \
+	inline ~TestObject ## index() { ShutdownLog::append(QStringLiteral("destroy%1").arg(index)); }
+
+#define HANGING_SHUTDOWN_HOOK(index) \
+	Q_INVOKABLE inline void qtmvvm_aboutToDestroy() { ShutdownLog::append(QStringLiteral("hook%1").arg(index)); ShutdownLog::hang().acquire(); } \
+	inline ~TestObject ## index() { ShutdownLog::append(QStringLiteral("destroy%1").arg(index)); }
+
+#define DESTROY_LOG(index) \
+	inline ~TestObject ## index() { ShutdownLog::append(QStringLiteral("destroy%1").arg(index)); }
+
 CREATE_TEST_OBJECT(0)
 
 CREATE_TEST_OBJECT(1, int data = 42;)
@@ -53,4 +94,27 @@ CREATE_TEST_OBJECT(12, SOMETIME_DESTROYER(12))
 CREATE_TEST_OBJECT(13, SOMETIME_DESTROYER(13))
 CREATE_TEST_OBJECT(14, NEVER_DESTROYER(14))
 
+CREATE_TEST_OBJECT(16, SHUTDOWN_HOOK(16))
+CREATE_TEST_OBJECT(17, DEP(16) SHUTDOWN_HOOK(17))
+CREATE_TEST_OBJECT(18, DEP(17) SHUTDOWN_HOOK(18))
+CREATE_TEST_OBJECT(19, DEP(16) SHUTDOWN_HOOK(19))
+
+CREATE_TEST_OBJECT(23, DESTROY_LOG(23))
+CREATE_TEST_OBJECT(20, DEP(23) HANGING_SHUTDOWN_HOOK(20))
+CREATE_TEST_OBJECT(21, DEP(20) DESTROY_LOG(21))
+CREATE_TEST_OBJECT(22, DEP(21) DESTROY_LOG(22))
+
+// can only be created by the typed registrations, as the constructor is not invokable
+class TestObject15 : public QObject
+{
+	Q_OBJECT
+
+public:
+	DEP(0)
+
+	explicit inline TestObject15(QObject *parent = nullptr) :
+		QObject{parent}
+	{}
+};
+
 #endif // TESTOBJECT_H
@@ -21,6 +21,7 @@ private Q_SLOTS:
 	void testRegistrations();
 	void testPlainConstructions();
 	void testDepedencyConstructions();
+	void testTypedConstructions();
 	void testInjection();
 
 #ifdef NO_MINGW_DEBUG_BUILD
@@ -136,6 +137,31 @@ void ServiceRegistryTest::testDepedencyConstructions()
 	}
 }
 
+void ServiceRegistryTest::testTypedConstructions()
+{
+	try {
+		// metaobject registrations verify the constructor when registering
+		QVERIFY_EXCEPTION_THROWN(ServiceRegistry::instance()->registerService(QByteArrayLiteral("TestObject15"), &TestObject15::staticMetaObject),
+								 ServiceConstructionException);
+		QVERIFY(!ServiceRegistry::instance()->isRegistered(QByteArrayLiteral("TestObject15")));
+
+		// typed registrations construct directly
+		ServiceRegistry::instance()->registerObject<TestObject15>();
+		auto obj1 = ServiceRegistry::instance()->service<TestObject15>();
+		QVERIFY(obj1);
+		QVERIFY(obj1->dep);
+
+		// and are used for metaobject based constructions as well
+		auto obj2 = qobject_cast<TestObject15*>(ServiceRegistry::instance()->constructInjected(&TestObject15::staticMetaObject, this));
+		QVERIFY(obj2);
+		QCOMPARE(obj2->parent(), this);
+		QVERIFY(obj2->dep);
+		obj2->deleteLater();
+	} catch(QException &e) {
+		QFAIL(e.what());
+	}
+}
+
 void ServiceRegistryTest::testInjection()
 {
 	try {
@@ -221,6 +247,22 @@ void ServiceRegistryTest::testDestructionScopes()
 			ServiceRegistry::instance()->registerObject<TestObject14>(ServiceRegistry::DestroyNever);
 			QVERIFY(ServiceRegistry::instance()->service<TestObject14>());
 			ServiceRegistry::instance()->service<TestObject14>()->holder = holder3;
+
+			//register services with shutdown hooks, with 18 -> 17 -> 16 and 19 -> 16
+			ServiceRegistry::instance()->registerObject<TestObject16>(ServiceRegistry::DestroyOnAppQuit);
+			ServiceRegistry::instance()->registerObject<TestObject17>(ServiceRegistry::DestroyOnAppQuit);
+			ServiceRegistry::instance()->registerObject<TestObject18>(ServiceRegistry::DestroyOnAppQuit);
+			ServiceRegistry::instance()->registerObject<TestObject19>(ServiceRegistry::DestroyOnAppQuit);
+			QVERIFY(ServiceRegistry::instance()->service<TestObject18>());
+			QVERIFY(ServiceRegistry::instance()->service<TestObject19>());
+
+			//register 22 -> 21 -> 20 -> 23, where the hook of 20 never finishes in time
+			ServiceRegistry::instance()->registerObject<TestObject20>(ServiceRegistry::DestroyOnAppQuit);
+			ServiceRegistry::instance()->registerObject<TestObject21>(ServiceRegistry::DestroyOnAppQuit);
+			ServiceRegistry::instance()->registerObject<TestObject22>(ServiceRegistry::DestroyOnAppQuit);
+			ServiceRegistry::instance()->registerObject<TestObject23>(ServiceRegistry::DestroyOnAppQuit);
+			QVERIFY(ServiceRegistry::instance()->service<TestObject22>());
+			ServiceRegistry::instance()->setShutdownTimeout(500);
 		}
 
 		QVERIFY(weak0);
@@ -234,6 +276,31 @@ void ServiceRegistryTest::testDestructionScopes()
 			QVERIFY(weak1);
 			QVERIFY(weak2);
 			QVERIFY(weak3);
+
+			// dependents go first, and hooks of independent services run before any of them is deleted
+			const auto fullLog = ShutdownLog::entries();
+			const auto log = fullLog.filter(QRegularExpression{QStringLiteral("^(hook|destroy)1[6-9]$")});
+			QCOMPARE(log.size(), 8);
+			auto hooks = log.mid(0, 2);
+			hooks.sort();
+			QCOMPARE(hooks, (QStringList{QStringLiteral("hook18"), QStringLiteral("hook19")}));
+			auto destroyed = log.mid(2, 2);
+			destroyed.sort();
+			QCOMPARE(destroyed, (QStringList{QStringLiteral("destroy18"), QStringLiteral("destroy19")}));
+			QCOMPARE(log.mid(4), (QStringList{
+									  QStringLiteral("hook17"),
+									  QStringLiteral("destroy17"),
+									  QStringLiteral("hook16"),
+									  QStringLiteral("destroy16")
+								  }));
+
+			// only the service with the hanging hook and its dependencies are left alive
+			QVERIFY(fullLog.contains(QStringLiteral("destroy22")));
+			QVERIFY(fullLog.contains(QStringLiteral("destroy21")));
+			QVERIFY(fullLog.indexOf(QStringLiteral("destroy21")) < fullLog.indexOf(QStringLiteral("hook20")));
+			QVERIFY(!fullLog.contains(QStringLiteral("destroy20")));
+			QVERIFY(!fullLog.contains(QStringLiteral("destroy23")));
+			ShutdownLog::hang().release();
 			called = true;
 		});
 
@@ -241,6 +308,7 @@ void ServiceRegistryTest::testDestructionScopes()
 		QTimer::singleShot(0, qApp, &QCoreApplication::quit);
 		QCoreApplication::exec();
 		QVERIFY(called);
+		ServiceRegistry::instance()->setShutdownTimeout(5000);
 		QVERIFY(!weak0);
 		QVERIFY(weak1);
 		QVERIFY(weak2);
@@ -12,6 +12,7 @@ private Q_SLOTS:
 	void testConfigLoader();
 
 	void testDefaultIcon();
+	void testFlatSetup();
 
 private:
 	Setup createEntryDocumentSetup();
@@ -189,6 +190,61 @@ void SettingsConfigLoaderTest::testDefaultIcon()
 	}
 }
 
+void SettingsConfigLoaderTest::testFlatSetup()
+{
+	try {
+		QFileSelector selector;
+		SettingsConfigLoader loader;
+		const auto path = QStringLiteral(SRCDIR "/categoryDocument.xml");
+		auto setup = loader.loadSetup(path, QStringLiteral("dummy"), &selector);
+		auto flat = loader.loadFlatSetup(path, QStringLiteral("dummy"), &selector);
+
+		QCOMPARE(flat.allowSearch(), setup.allowSearch);
+		QCOMPARE(flat.allowRestore(), setup.allowRestore);
+		QCOMPARE(flat.categoryCount(), setup.categories.size());
+		auto sIndex = 0;
+		auto gIndex = 0;
+		auto eIndex = 0;
+		for(auto i = 0; i < setup.categories.size(); i++) {
+			const auto &category = setup.categories[i];
+			QCOMPARE(flat.category(i).title, category.title);
+			QVERIFY(flat.category(i).sections.isEmpty());
+			QCOMPARE(flat.categorySections(i).begin, sIndex);
+			QCOMPARE(flat.categorySections(i).size(), category.sections.size());
+			for(const auto &section : category.sections) {
+				QCOMPARE(flat.section(sIndex).title, section.title);
+				QCOMPARE(flat.sectionCategory(sIndex), i);
+				QCOMPARE(flat.sectionGroups(sIndex).begin, gIndex);
+				QCOMPARE(flat.sectionGroups(sIndex).size(), section.groups.size());
+				for(const auto &group : section.groups) {
+					QCOMPARE(flat.group(gIndex).title, group.title);
+					QCOMPARE(flat.groupSection(gIndex), sIndex);
+					QCOMPARE(flat.groupEntries(gIndex).begin, eIndex);
+					QCOMPARE(flat.groupEntries(gIndex).size(), group.entries.size());
+					for(const auto &entry : group.entries) {
+						QCOMPARE(flat.entry(eIndex).key, entry.key);
+						QCOMPARE(flat.entry(eIndex).properties, entry.properties);
+						QCOMPARE(flat.entryGroup(eIndex), gIndex);
+						++eIndex;
+					}
+					++gIndex;
+				}
+				++sIndex;
+			}
+		}
+		QCOMPARE(flat.sectionCount(), sIndex);
+		QCOMPARE(flat.groupCount(), gIndex);
+		QCOMPARE(flat.entryCount(), eIndex);
+
+		// cached setups are shared, not copied
+		auto flat2 = loader.loadFlatSetup(path, QStringLiteral("dummy"), &selector);
+		QVERIFY(flat.entryCount() > 0);
+		QCOMPARE(&flat2.entry(0), &flat.entry(0));
+	} catch(std::exception &e) {
+		QFAIL(e.what());
+	}
+}
+
 Setup SettingsConfigLoaderTest::createEntryDocumentSetup()
 {
 	return Setup {
@@ -0,0 +1,16 @@
+TEMPLATE = app
+
+QT += testlib mvvmcore concurrent
+QT -= gui
+CONFIG += console
+CONFIG -= app_bundle
+
+TARGET = tst_snapshotsettingsaccessor
+
+HEADERS += \
+	../../../shared/tst_isettingsaccessor.h
+
+SOURCES += \
+	tst_snapshotsettingsaccessor.cpp
+
+include(../../testrun.pri)
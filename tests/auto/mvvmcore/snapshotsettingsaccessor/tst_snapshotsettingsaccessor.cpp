@@ -0,0 +1,116 @@
+#include <QtTest>
+#include <QtCore>
+#include <QtConcurrent>
+#include <QtMvvmCore/QSettingsAccessor>
+#include <QtMvvmCore/SnapshotSettingsAccessor>
+#include "../../../shared/tst_isettingsaccessor.h"
+using namespace QtMvvm;
+
+class SnapshotSettingsAccessorTest : public ISettingsAccessorTest
+{
+	Q_OBJECT
+
+protected:
+	ISettingsAccessor *createFirst() override;
+	ISettingsAccessor *createSecond() override;
+	bool testSyncChangeSignals() override;
+
+private Q_SLOTS:
+	void initTestCase();
+	void cleanupTestCase();
+
+	void testSnapshotVersions();
+	void testConcurrentReads();
+
+private:
+	QTemporaryFile *tempFile;
+};
+
+ISettingsAccessor *SnapshotSettingsAccessorTest::createFirst()
+{
+	auto settings = new QSettings{tempFile->fileName(), QSettings::IniFormat, this};
+	return new SnapshotSettingsAccessor{new QSettingsAccessor{settings}, this};
+}
+
+ISettingsAccessor *SnapshotSettingsAccessorTest::createSecond()
+{
+	return createFirst();
+}
+
+bool SnapshotSettingsAccessorTest::testSyncChangeSignals()
+{
+	return false;
+}
+
+void SnapshotSettingsAccessorTest::initTestCase()
+{
+	tempFile = new QTemporaryFile{this};
+	QVERIFY(tempFile->open());
+	tempFile->close();
+}
+
+void SnapshotSettingsAccessorTest::cleanupTestCase()
+{
+	delete tempFile;
+}
+
+void SnapshotSettingsAccessorTest::testSnapshotVersions()
+{
+	auto accessor = qobject_cast<SnapshotSettingsAccessor*>(createFirst());
+	QVERIFY(accessor);
+
+	auto version = accessor->version();
+	auto oldSnapshot = accessor->snapshot();
+	accessor->save(QStringLiteral("snapshot/key"), 42);
+	QVERIFY(accessor->version() > version);
+	QVERIFY(!oldSnapshot.contains(QStringLiteral("snapshot/key")));
+	QCOMPARE(accessor->snapshot().value(QStringLiteral("snapshot/key")).toInt(), 42);
+
+	// saving the same value again does not publish a new snapshot
+	version = accessor->version();
+	accessor->save(QStringLiteral("snapshot/key"), 42);
+	QCOMPARE(accessor->version(), version);
+
+	accessor->remove(QStringLiteral("snapshot"));
+	QVERIFY(!accessor->snapshot().contains(QStringLiteral("snapshot/key")));
+	QVERIFY(accessor->version() > version);
+	accessor->deleteLater();
+}
+
+void SnapshotSettingsAccessorTest::testConcurrentReads()
+{
+	auto accessor = qobject_cast<SnapshotSettingsAccessor*>(createFirst());
+	QVERIFY(accessor);
+	const auto key = QStringLiteral("concurrent/key");
+	accessor->save(key, 0);
+
+	QAtomicInt stop = 0;
+	QAtomicInt failures = 0;
+	auto reader = [&]() {
+		auto lastValue = 0;
+		while(!stop.load()) {
+			auto value = accessor->load(key, -1).toInt();
+			// values are only ever increased, so a reader must never see an older one
+			if(value < lastValue)
+				failures.ref();
+			lastValue = value;
+		}
+	};
+	QList<QFuture<void>> readers;
+	for(auto i = 0; i < 4; i++)
+		readers.append(QtConcurrent::run(reader));
+
+	for(auto i = 1; i <= 1000; i++)
+		accessor->save(key, i);
+	stop.store(1);
+	for(auto &future : readers)
+		future.waitForFinished();
+
+	QCOMPARE(failures.load(), 0);
+	QCOMPARE(accessor->load(key).toInt(), 1000);
+	accessor->deleteLater();
+}
+
+QTEST_MAIN(SnapshotSettingsAccessorTest)
+
+#include "tst_snapshotsettingsaccessor.moc"
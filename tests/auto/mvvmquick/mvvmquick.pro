@@ -0,0 +1,9 @@
+TEMPLATE = subdirs
+
+SUBDIRS += \
+	quickpresenter \
+	sectionlistview \
+	presentingstackview
+
+prepareRecursiveTarget(run-tests)
+QMAKE_EXTRA_TARGETS += run-tests
@@ -0,0 +1,12 @@
+TEMPLATE = app
+
+QT += testlib quick mvvmquick
+CONFIG += console
+CONFIG -= app_bundle
+
+TARGET = tst_presentingstackview
+
+SOURCES += \
+	tst_presentingstackview.cpp
+
+include(../../testrun.pri)
@@ -0,0 +1,286 @@
+#include <QtTest>
+#include <QtQml>
+#include <QtQuick/QQuickItem>
+#include <QtQuick/QQuickWindow>
+#include <QtMvvmCore/ViewModel>
+#include <QtMvvmQuick/QuickPresenter>
+using namespace QtMvvm;
+
+class PresentingStackViewTest : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void initTestCase();
+	void init();
+	void cleanup();
+
+	void testUnloadOnPush();
+	void testReloadOnPop();
+	void testCloseAction();
+	void testKeepHostingViews();
+
+private:
+	QTemporaryDir tDir;
+	QQmlEngine *engine = nullptr;
+	QQmlComponent *stackComponent = nullptr;
+	QQmlComponent *viewComponent = nullptr;
+	QQuickWindow *window = nullptr;
+	QQuickItem *stack = nullptr;
+
+	QQuickItem *createView(ViewModel *viewModel);
+	bool present(QQuickItem *presenter, QQuickItem *view);
+	bool callBool(QObject *object, const char *method);
+	bool isBusy() const;
+	int depth() const;
+	QQuickItem *page(int index);
+	QQuickItem *pageView(int index);
+};
+
+void PresentingStackViewTest::initTestCase()
+{
+	QVERIFY(tDir.isValid());
+	QuickPresenter::registerAsPresenter<QuickPresenter>();
+	engine = new QQmlEngine{this};
+
+	// views are restored from their url, so they must be real files
+	QFile viewFile{tDir.filePath(QStringLiteral("TestView.qml"))};
+	QVERIFY(viewFile.open(QIODevice::WriteOnly | QIODevice::Text));
+	viewFile.write("import QtQuick 2.10\n"
+				   "Item {\n"
+				   "	id: _view\n"
+				   "	property var viewModel: null\n"
+				   "	// presents child views into itself, like a nested presenter\n"
+				   "	function presentItem(item) {\n"
+				   "		item.parent = _host;\n"
+				   "		return true;\n"
+				   "	}\n"
+				   "	Item {\n"
+				   "		id: _host\n"
+				   "		anchors.fill: parent\n"
+				   "	}\n"
+				   "}\n");
+	viewFile.close();
+	viewComponent = new QQmlComponent{engine, QUrl::fromLocalFile(viewFile.fileName()), this};
+	QVERIFY2(viewComponent->isReady(), qUtf8Printable(viewComponent->errorString()));
+
+	stackComponent = new QQmlComponent{engine, this};
+	stackComponent->setData("import QtQuick 2.10\n"
+							"import de.skycoder42.QtMvvm.Quick 1.1\n"
+							"PresentingStackView {\n"
+							"	width: 200\n"
+							"	height: 200\n"
+							"	keepLoadedDepth: 0\n"
+							"	animDuration: 0\n"
+							"	opDuration: 0\n"
+							"}\n",
+							QUrl{QStringLiteral("qrc:/TestStackView.qml")});
+	QVERIFY2(stackComponent->isReady(), qUtf8Printable(stackComponent->errorString()));
+}
+
+void PresentingStackViewTest::init()
+{
+	window = new QQuickWindow{};
+	window->resize(200, 200);
+	stack = qobject_cast<QQuickItem*>(stackComponent->create());
+	QVERIFY(stack);
+	stack->setParent(window);
+	stack->setParentItem(window->contentItem());
+	window->show();
+}
+
+void PresentingStackViewTest::cleanup()
+{
+	delete window;
+	window = nullptr;
+	stack = nullptr;
+}
+
+void PresentingStackViewTest::testUnloadOnPush()
+{
+	QPointer<ViewModel> viewModelA = new ViewModel{};
+	QPointer<QQuickItem> viewA = createView(viewModelA);
+	QVERIFY(present(stack, viewA));
+	QTRY_VERIFY(!isBusy());
+	QCOMPARE(pageView(0), viewA.data());
+
+	QPointer<ViewModel> viewModelB = new ViewModel{};
+	QPointer<QQuickItem> viewB = createView(viewModelB);
+	QVERIFY(present(stack, viewB));
+	QTRY_VERIFY(!isBusy());
+
+	// only the top most view stays loaded, the hidden ones keep their viewmodel
+	QTRY_VERIFY(!viewA);
+	QVERIFY(!pageView(0));
+	QCOMPARE(pageView(1), viewB.data());
+	QVERIFY(viewModelA);
+	QCOMPARE(viewModelA->parent(), page(0));
+	QCOMPARE(page(0)->property("viewModel").value<ViewModel*>(), viewModelA.data());
+
+	QPointer<ViewModel> viewModelC = new ViewModel{};
+	QVERIFY(present(stack, createView(viewModelC)));
+	QTRY_VERIFY(!isBusy());
+	QCOMPARE(depth(), 3);
+	QTRY_VERIFY(!viewB);
+	QVERIFY(!pageView(0));
+	QVERIFY(!pageView(1));
+	QVERIFY(pageView(2));
+	QVERIFY(viewModelA);
+	QVERIFY(viewModelB);
+}
+
+void PresentingStackViewTest::testReloadOnPop()
+{
+	QPointer<ViewModel> viewModelA = new ViewModel{};
+	QVERIFY(present(stack, createView(viewModelA)));
+	QTRY_VERIFY(!isBusy());
+	QPointer<ViewModel> viewModelB = new ViewModel{};
+	QPointer<QQuickItem> viewB = createView(viewModelB);
+	QVERIFY(present(stack, viewB));
+	QTRY_VERIFY(!isBusy());
+	QPointer<ViewModel> viewModelC = new ViewModel{};
+	QVERIFY(present(stack, createView(viewModelC)));
+	QTRY_VERIFY(!isBusy());
+	QTRY_VERIFY(!viewB);
+
+	QVERIFY(callBool(stack, "safePop"));
+	QTRY_VERIFY(!isBusy());
+	QCOMPARE(depth(), 2);
+	QTRY_VERIFY(!viewModelC);
+
+	// the view is created again, with the same viewmodel
+	auto restored = pageView(1);
+	QVERIFY(restored);
+	QCOMPARE(restored->property("viewModel").value<ViewModel*>(), viewModelB.data());
+	QCOMPARE(viewModelB->parent(), restored);
+	QVERIFY(!pageView(0));
+	QVERIFY(viewModelA);
+}
+
+void PresentingStackViewTest::testCloseAction()
+{
+	QPointer<ViewModel> viewModelA = new ViewModel{};
+	QVERIFY(present(stack, createView(viewModelA)));
+	QTRY_VERIFY(!isBusy());
+	QPointer<ViewModel> viewModelB = new ViewModel{};
+	QVERIFY(present(stack, createView(viewModelB)));
+	QTRY_VERIFY(!isBusy());
+	QPointer<ViewModel> viewModelC = new ViewModel{};
+	QVERIFY(present(stack, createView(viewModelC)));
+	QTRY_VERIFY(!isBusy());
+	QTRY_VERIFY(!pageView(0) && !pageView(1));
+
+	// an unloaded page has no view to forward the close action to
+	QVERIFY(!callBool(page(1), "closeAction"));
+	QCOMPARE(depth(), 3);
+
+	QVERIFY(callBool(stack, "closeAction"));
+	QTRY_VERIFY(!isBusy());
+	QCOMPARE(depth(), 2);
+	QVERIFY(pageView(1));
+	QCOMPARE(pageView(1)->property("viewModel").value<ViewModel*>(), viewModelB.data());
+
+	QVERIFY(callBool(stack, "closeAction"));
+	QTRY_VERIFY(!isBusy());
+	QCOMPARE(depth(), 1);
+	QTRY_VERIFY(!viewModelB);
+	QVERIFY(pageView(0));
+	QCOMPARE(pageView(0)->property("viewModel").value<ViewModel*>(), viewModelA.data());
+	QTRY_VERIFY(!viewModelC);
+}
+
+void PresentingStackViewTest::testKeepHostingViews()
+{
+	QPointer<ViewModel> viewModelA = new ViewModel{};
+	QPointer<QQuickItem> viewA = createView(viewModelA);
+	QVERIFY(present(stack, viewA));
+	QTRY_VERIFY(!isBusy());
+
+	// a child view presented into the first one
+	QPointer<ViewModel> childViewModel = new ViewModel{};
+	QPointer<QQuickItem> childView = createView(childViewModel);
+	QVERIFY(present(viewA, childView));
+	QCOMPARE(childView->parentItem()->parentItem(), viewA.data());
+
+	QPointer<ViewModel> viewModelB = new ViewModel{};
+	QVERIFY(present(stack, createView(viewModelB)));
+	QTRY_VERIFY(!isBusy());
+	QPointer<ViewModel> viewModelC = new ViewModel{};
+	QVERIFY(present(stack, createView(viewModelC)));
+	QTRY_VERIFY(!isBusy());
+
+	// the view hosting the child stays loaded, the other one is unloaded
+	QTRY_VERIFY(!pageView(1));
+	QCOMPARE(pageView(0), viewA.data());
+	QVERIFY(childView);
+	QVERIFY(childViewModel);
+
+	// once the child is gone, the view is unloaded with the next navigation
+	delete childView;
+	QVERIFY(!childViewModel);
+	QVERIFY(present(stack, createView(new ViewModel{})));
+	QTRY_VERIFY(!isBusy());
+	QTRY_VERIFY(!viewA);
+	QVERIFY(!pageView(0));
+	QVERIFY(viewModelA);
+}
+
+QQuickItem *PresentingStackViewTest::createView(ViewModel *viewModel)
+{
+	// same as the QQmlQuickPresenter does for presented views
+	auto view = qobject_cast<QQuickItem*>(viewComponent->beginCreate(engine->rootContext()));
+	if(!view)
+		return nullptr;
+	view->setProperty("viewModel", QVariant::fromValue(viewModel));
+	viewModel->setParent(view);
+	viewComponent->completeCreate();
+	QQmlEngine::setObjectOwnership(view, QQmlEngine::JavaScriptOwnership);
+	return view;
+}
+
+bool PresentingStackViewTest::present(QQuickItem *presenter, QQuickItem *view)
+{
+	QVariant presented = false;
+	if(!view || !QMetaObject::invokeMethod(presenter, "presentItem",
+										   Q_RETURN_ARG(QVariant, presented),
+										   Q_ARG(QVariant, QVariant::fromValue<QObject*>(view))))
+		return false;
+	return presented.toBool();
+}
+
+bool PresentingStackViewTest::callBool(QObject *object, const char *method)
+{
+	QVariant result = false;
+	if(!QMetaObject::invokeMethod(object, method, Q_RETURN_ARG(QVariant, result)))
+		return false;
+	return result.toBool();
+}
+
+bool PresentingStackViewTest::isBusy() const
+{
+	return stack->property("busy").toBool();
+}
+
+int PresentingStackViewTest::depth() const
+{
+	return stack->property("depth").toInt();
+}
+
+QQuickItem *PresentingStackViewTest::page(int index)
+{
+	QQuickItem *page = nullptr;
+	QMetaObject::invokeMethod(stack, "get",
+							  Q_RETURN_ARG(QQuickItem*, page),
+							  Q_ARG(int, index));
+	return page;
+}
+
+QQuickItem *PresentingStackViewTest::pageView(int index)
+{
+	auto item = page(index);
+	return item ? item->property("view").value<QQuickItem*>() : nullptr;
+}
+
+QTEST_MAIN(PresentingStackViewTest)
+
+#include "tst_presentingstackview.moc"
@@ -0,0 +1,178 @@
+#include <QtTest>
+#include <QtQml>
+#include <QtQuick/QQuickItem>
+#include <QtMvvmQuick/QuickPresenter>
+using namespace QtMvvm;
+
+class TestQmlPresenter : public QObject
+{
+	Q_OBJECT
+
+public:
+	QByteArray lastMethod;
+
+	Q_INVOKABLE QVariant presentItem(const QVariant &item) {
+		Q_UNUSED(item)
+		lastMethod = "presentItem";
+		return true;
+	}
+
+	Q_INVOKABLE QVariant presentDrawerContent(const QVariant &item) {
+		Q_UNUSED(item)
+		lastMethod = "presentDrawerContent";
+		return true;
+	}
+
+	Q_INVOKABLE QVariant presentTab(const QVariant &item) {
+		Q_UNUSED(item)
+		lastMethod = "presentTab";
+		return true;
+	}
+};
+
+class QuickPresenterTest : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void initTestCase();
+	void cleanupTestCase();
+
+	void testPresentMethod();
+	void testPresentMethodObjectName();
+	void testPresentMethodQmlPresenter();
+
+private:
+	QQmlEngine *engine = nullptr;
+	QQmlComponent *itemComponent = nullptr;
+	QQmlComponent *drawerComponent = nullptr;
+
+	QQmlComponent *createComponent(const QString &fileName);
+	QQmlComponent *createPresenterComponent(const QString &fileName, const QByteArray &methods);
+};
+
+void QuickPresenterTest::initTestCase()
+{
+	engine = new QQmlEngine{this};
+	itemComponent = createComponent(QStringLiteral("TestItemView.qml"));
+	QVERIFY2(itemComponent->isReady(), qUtf8Printable(itemComponent->errorString()));
+	drawerComponent = createComponent(QStringLiteral("TestDrawerView.qml"));
+	QVERIFY2(drawerComponent->isReady(), qUtf8Printable(drawerComponent->errorString()));
+}
+
+void QuickPresenterTest::cleanupTestCase()
+{
+	delete itemComponent;
+	delete drawerComponent;
+}
+
+void QuickPresenterTest::testPresentMethod()
+{
+	QuickPresenter presenter;
+	TestQmlPresenter qmlPresenter;
+
+	// alternate between two QML types, each instance has its own meta object
+	for(auto i = 0; i < 3; i++) {
+		QScopedPointer<QObject> item{itemComponent->create()};
+		QVERIFY(item);
+		QVERIFY(presenter.presentToQml(&qmlPresenter, item.data()));
+		QCOMPARE(qmlPresenter.lastMethod, QByteArray{"presentItem"});
+		// free the item first, so the drawer may reuse its memory
+		item.reset();
+
+		QScopedPointer<QObject> drawer{drawerComponent->create()};
+		QVERIFY(drawer);
+		QVERIFY(presenter.presentToQml(&qmlPresenter, drawer.data()));
+		QCOMPARE(qmlPresenter.lastMethod, QByteArray{"presentDrawerContent"});
+	}
+}
+
+void QuickPresenterTest::testPresentMethodObjectName()
+{
+	QuickPresenter presenter;
+	TestQmlPresenter qmlPresenter;
+
+	QScopedPointer<QObject> item{itemComponent->create()};
+	QVERIFY(presenter.presentToQml(&qmlPresenter, item.data()));
+	QCOMPARE(qmlPresenter.lastMethod, QByteArray{"presentItem"});
+
+	// the same type with a different object name uses a different method
+	QScopedPointer<QObject> tab{itemComponent->create()};
+	tab->setObjectName(QStringLiteral("tabView"));
+	QVERIFY(presenter.presentToQml(&qmlPresenter, tab.data()));
+	QCOMPARE(qmlPresenter.lastMethod, QByteArray{"presentTab"});
+
+	QVERIFY(presenter.presentToQml(&qmlPresenter, item.data()));
+	QCOMPARE(qmlPresenter.lastMethod, QByteArray{"presentItem"});
+}
+
+void QuickPresenterTest::testPresentMethodQmlPresenter()
+{
+	QuickPresenter presenter;
+	// both have a presentItem method, but at a different method index
+	QScopedPointer<QQmlComponent> itemPresenterComponent{createPresenterComponent(QStringLiteral("ItemPresenter.qml"),
+		"	function presentItem(item) { lastMethod = \"item\"; return true; }\n")};
+	QVERIFY2(itemPresenterComponent->isReady(), qUtf8Printable(itemPresenterComponent->errorString()));
+	QScopedPointer<QQmlComponent> tabPresenterComponent{createPresenterComponent(QStringLiteral("TabPresenter.qml"),
+		"	function presentTab(item) { lastMethod = \"tab\"; return true; }\n"
+		"	function presentDrawerContent(item) { lastMethod = \"drawer\"; return true; }\n"
+		"	function presentItem(item) { lastMethod = \"tabItem\"; return true; }\n")};
+	QVERIFY2(tabPresenterComponent->isReady(), qUtf8Printable(tabPresenterComponent->errorString()));
+
+	QScopedPointer<QObject> item{itemComponent->create()};
+	QVERIFY(item);
+	// alternate between presenter instances, each instance has its own meta object
+	for(auto i = 0; i < 3; i++) {
+		QScopedPointer<QObject> itemPresenter{itemPresenterComponent->create()};
+		QVERIFY(itemPresenter);
+		QVERIFY(presenter.presentToQml(itemPresenter.data(), item.data()));
+		QCOMPARE(itemPresenter->property("lastMethod").toString(), QStringLiteral("item"));
+		// free the presenter first, so the next one may reuse its memory
+		itemPresenter.reset();
+
+		QScopedPointer<QObject> tabPresenter{tabPresenterComponent->create()};
+		QVERIFY(tabPresenter);
+		QVERIFY(presenter.presentToQml(tabPresenter.data(), item.data()));
+		QCOMPARE(tabPresenter->property("lastMethod").toString(), QStringLiteral("tabItem"));
+		tabPresenter.reset();
+	}
+
+	// two living instances of the same type
+	QScopedPointer<QObject> presenter1{tabPresenterComponent->create()};
+	QScopedPointer<QObject> presenter2{tabPresenterComponent->create()};
+	QVERIFY(presenter.presentToQml(presenter1.data(), item.data()));
+	QVERIFY(presenter.presentToQml(presenter2.data(), item.data()));
+	QCOMPARE(presenter1->property("lastMethod").toString(), QStringLiteral("tabItem"));
+	QCOMPARE(presenter2->property("lastMethod").toString(), QStringLiteral("tabItem"));
+	presenter1.reset();
+	QVERIFY(presenter.presentToQml(presenter2.data(), item.data()));
+	QCOMPARE(presenter2->property("lastMethod").toString(), QStringLiteral("tabItem"));
+}
+
+QQmlComponent *QuickPresenterTest::createComponent(const QString &fileName)
+{
+	// the custom property gives every instance its own dynamic meta object
+	auto component = new QQmlComponent{engine};
+	component->setData("import QtQuick 2.10\n"
+					   "Item {\n"
+					   "	property int counter: 0\n"
+					   "}\n",
+					   QUrl{QStringLiteral("qrc:/views/") + fileName});
+	return component;
+}
+
+QQmlComponent *QuickPresenterTest::createPresenterComponent(const QString &fileName, const QByteArray &methods)
+{
+	auto component = new QQmlComponent{engine};
+	component->setData("import QtQml 2.2\n"
+					   "QtObject {\n"
+					   "	property string lastMethod\n" +
+					   methods +
+					   "}\n",
+					   QUrl{QStringLiteral("qrc:/presenters/") + fileName});
+	return component;
+}
+
+QTEST_MAIN(QuickPresenterTest)
+
+#include "tst_quickpresenter.moc"
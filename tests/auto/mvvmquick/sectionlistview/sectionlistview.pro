@@ -0,0 +1,12 @@
+TEMPLATE = app
+
+QT += testlib quick mvvmquick
+CONFIG += console
+CONFIG -= app_bundle
+
+TARGET = tst_sectionlistview
+
+SOURCES += \
+	tst_sectionlistview.cpp
+
+include(../../testrun.pri)
@@ -0,0 +1,176 @@
+#include <QtTest>
+#include <QtQml>
+#include <QtGui/QStandardItemModel>
+#include <QtQuick/QQuickItem>
+#include <QtQuick/QQuickWindow>
+#include <QtMvvmQuick/QuickPresenter>
+using namespace QtMvvm;
+
+class SectionListViewTest : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void initTestCase();
+	void cleanupTestCase();
+
+	void testReusedRows();
+
+private:
+	enum Roles {
+		GroupRole = Qt::UserRole + 1,
+		TitleRole,
+		DelegateUrlRole,
+		DelegateComponentRole,
+		PropertiesRole
+	};
+
+	QQmlEngine *engine = nullptr;
+	QQmlComponent *viewComponent = nullptr;
+	QQmlComponent *delegateComponent = nullptr;
+
+	QStandardItemModel *createModel(int count);
+	// returns the number of loaded rows, or -1 if one of them shows values of a different entry
+	int checkRows(QQuickItem *view) const;
+	void findLoaders(QQuickItem *item, QList<QQuickItem*> &loaders) const;
+};
+
+void SectionListViewTest::initTestCase()
+{
+	QuickPresenter::registerAsPresenter<QuickPresenter>();
+	engine = new QQmlEngine{this};
+
+	// the view is internal to the module, so it is loaded from the installed file
+	QUrl viewUrl;
+	for(const auto &path : engine->importPathList()) {
+		QFileInfo info{QDir{path}, QStringLiteral("de/skycoder42/QtMvvm/Quick/SectionListView.qml")};
+		if(info.exists()) {
+			viewUrl = QUrl::fromLocalFile(info.absoluteFilePath());
+			break;
+		}
+	}
+	QVERIFY2(viewUrl.isValid(), "Unable to find SectionListView.qml in the QML import paths");
+	viewComponent = new QQmlComponent{engine, viewUrl, this};
+	QTRY_VERIFY2(viewComponent->isReady(), qUtf8Printable(viewComponent->errorString()));
+
+	// every entry uses the same delegate, but sets a different subset of its properties
+	delegateComponent = new QQmlComponent{engine, this};
+	delegateComponent->setData("import QtQuick 2.10\n"
+							   "Item {\n"
+							   "	implicitHeight: 40\n"
+							   "	property string text: \"default\"\n"
+							   "	property int number: -1\n"
+							   "	property string extra: \"default\"\n"
+							   "}\n",
+							   QUrl{QStringLiteral("qrc:/delegates/TestDelegate.qml")});
+	QVERIFY2(delegateComponent->isReady(), qUtf8Printable(delegateComponent->errorString()));
+}
+
+void SectionListViewTest::cleanupTestCase()
+{
+	delete viewComponent;
+	delete delegateComponent;
+}
+
+void SectionListViewTest::testReusedRows()
+{
+	QQuickWindow window;
+	window.resize(200, 200);
+	QScopedPointer<QStandardItemModel> model{createModel(200)};
+
+	QScopedPointer<QQuickItem> view{qobject_cast<QQuickItem*>(viewComponent->beginCreate(engine->rootContext()))};
+	QVERIFY(view);
+	view->setParentItem(window.contentItem());
+	view->setSize({200, 200});
+	view->setProperty("model", QVariant::fromValue<QObject*>(model.data()));
+	viewComponent->completeCreate();
+	window.show();
+
+	QTRY_VERIFY(checkRows(view.data()) > 0);
+	const auto contentHeight = view->property("contentHeight").toReal();
+	QVERIFY(contentHeight > 1000);
+	// scroll down and up again, so rows are reused for entries with different properties
+	for(qreal y = 0; y < contentHeight - 200; y += 130) {
+		view->setProperty("contentY", y);
+		QTRY_VERIFY(checkRows(view.data()) > 0);
+	}
+	for(qreal y = contentHeight - 200; y > 0; y -= 170) {
+		view->setProperty("contentY", y);
+		QTRY_VERIFY(checkRows(view.data()) > 0);
+	}
+}
+
+QStandardItemModel *SectionListViewTest::createModel(int count)
+{
+	auto model = new QStandardItemModel{};
+	model->setItemRoleNames({
+		{GroupRole, "group"},
+		{TitleRole, "title"},
+		{DelegateUrlRole, "delegateUrl"},
+		{DelegateComponentRole, "delegateComponent"},
+		{PropertiesRole, "properties"}
+	});
+	for(auto i = 0; i < count; i++) {
+		QVariantMap properties {
+			{QStringLiteral("text"), QStringLiteral("entry %1").arg(i)}
+		};
+		switch(i % 3) {
+		case 0:
+			properties.insert(QStringLiteral("number"), i);
+			break;
+		case 1:
+			properties.insert(QStringLiteral("extra"), QStringLiteral("extra %1").arg(i));
+			break;
+		default:
+			break;
+		}
+
+		auto item = new QStandardItem{};
+		item->setData(QStringLiteral("group %1").arg(i / 20), GroupRole);
+		item->setData(QStringLiteral("Entry %1").arg(i), TitleRole);
+		item->setData(delegateComponent->url(), DelegateUrlRole);
+		item->setData(QVariant::fromValue<QObject*>(delegateComponent), DelegateComponentRole);
+		item->setData(properties, PropertiesRole);
+		model->appendRow(item);
+	}
+	return model;
+}
+
+int SectionListViewTest::checkRows(QQuickItem *view) const
+{
+	QList<QQuickItem*> loaders;
+	findLoaders(view, loaders);
+	auto loaded = 0;
+	for(auto loader : qAsConst(loaders)) {
+		auto item = loader->property("item").value<QObject*>();
+		if(!item)
+			return 0;
+
+		// pooled rows keep their last entry, so they must still match it
+		const auto properties = loader->parentItem()->property("entryProperties").toMap();
+		if(item->property("text") != properties.value(QStringLiteral("text")) ||
+		   item->property("number").toInt() != properties.value(QStringLiteral("number"), -1).toInt() ||
+		   item->property("extra").toString() != properties.value(QStringLiteral("extra"), QStringLiteral("default")).toString()) {
+			qWarning() << "Row shows" << item->property("text") << item->property("number") << item->property("extra")
+					   << "instead of" << properties;
+			return -1;
+		}
+		loaded++;
+	}
+	return loaded;
+}
+
+void SectionListViewTest::findLoaders(QQuickItem *item, QList<QQuickItem*> &loaders) const
+{
+	// delegates are only children of the content item, not of the view
+	for(auto child : item->childItems()) {
+		if(child->inherits("QQuickLoader"))
+			loaders.append(child);
+		else
+			findLoaders(child, loaders);
+	}
+}
+
+QTEST_MAIN(SectionListViewTest)
+
+#include "tst_sectionlistview.moc"
@@ -0,0 +1,7 @@
+TEMPLATE = subdirs
+
+SUBDIRS += \
+	selectcombobox
+
+prepareRecursiveTarget(run-tests)
+QMAKE_EXTRA_TARGETS += run-tests
@@ -0,0 +1,12 @@
+TEMPLATE = app
+
+QT += testlib widgets mvvmwidgets mvvmwidgets-private
+CONFIG += console
+CONFIG -= app_bundle
+
+TARGET = tst_selectcombobox
+
+SOURCES += \
+	tst_selectcombobox.cpp
+
+include(../../testrun.pri)
@@ -0,0 +1,180 @@
+#include <QtTest>
+#include <QtWidgets/QLineEdit>
+#include <QtWidgets/QCompleter>
+#include <QtMvvmWidgets/private/selectcombobox_p.h>
+using namespace QtMvvm;
+
+class SelectComboBoxTest : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void testFindValue();
+	void testFindValueAmbiguous();
+	void testSharedModel();
+	void testFilterPopup();
+	void testFilterPopupEditable();
+
+private:
+	static QVariantMap element(const QString &name, const QVariant &value);
+};
+
+void SelectComboBoxTest::testFindValue()
+{
+	SelectListModel model {QVariantList {
+		QStringLiteral("baum"),
+		element(QStringLiteral("One"), 1),
+		element(QStringLiteral("Two"), 2),
+		element(QStringLiteral("Other one"), 1)
+	}};
+
+	QCOMPARE(model.rowCount(), 4);
+	QCOMPARE(model.data(model.index(0)), QVariant{QStringLiteral("baum")});
+	QCOMPARE(model.data(model.index(0), Qt::UserRole), QVariant{QStringLiteral("baum")});
+	QCOMPARE(model.data(model.index(1)), QVariant{QStringLiteral("One")});
+	QCOMPARE(model.data(model.index(1), Qt::UserRole), QVariant{1});
+
+	QCOMPARE(model.findValue(QStringLiteral("baum")), 0);
+	QCOMPARE(model.findValue(2), 2);
+	// the first row with a value is found
+	QCOMPARE(model.findValue(1), 1);
+	QCOMPARE(model.findValue(3), -1);
+	QCOMPARE(model.findValue(QStringLiteral("One")), -1);
+}
+
+void SelectComboBoxTest::testFindValueAmbiguous()
+{
+	// points have no string representation, so all of them share the same hash key
+	SelectListModel model {QVariantList {
+		element(QStringLiteral("A"), QPoint{1, 1}),
+		element(QStringLiteral("B"), QPoint{2, 2}),
+		element(QStringLiteral("C"), QPoint{3, 3}),
+		QStringLiteral("baum")
+	}};
+
+	QCOMPARE(model.findValue(QPoint{1, 1}), 0);
+	QCOMPARE(model.findValue(QPoint{2, 2}), 1);
+	QCOMPARE(model.findValue(QPoint{3, 3}), 2);
+	QCOMPARE(model.findValue(QStringLiteral("baum")), 3);
+	QCOMPARE(model.findValue(QPoint{4, 4}), -1);
+}
+
+void SelectComboBoxTest::testSharedModel()
+{
+	const QVariantList elements {
+		element(QStringLiteral("One"), 1),
+		element(QStringLiteral("Two"), 2)
+	};
+	// an equal list that is not a copy of the first one
+	const QVariantList equalElements {
+		element(QStringLiteral("One"), 1),
+		element(QStringLiteral("Two"), 2)
+	};
+	const QVariantList otherElements {
+		element(QStringLiteral("One"), 1)
+	};
+
+	auto model = SelectListModel::shared(elements);
+	QVERIFY(model);
+	QCOMPARE(SelectListModel::shared(elements).data(), model.data());
+	QCOMPARE(SelectListModel::shared(equalElements).data(), model.data());
+	auto otherModel = SelectListModel::shared(otherElements);
+	QVERIFY(otherModel);
+	QVERIFY(otherModel != model);
+
+	// boxes with the same elements use the same model
+	SelectComboBox box1;
+	box1.setListElements(elements);
+	SelectComboBox box2;
+	box2.setListElements(equalElements);
+	QCOMPARE(box1.model(), model.data());
+	QCOMPARE(box2.model(), model.data());
+	QCOMPARE(box1.listElements(), elements);
+
+	box1.setCurrentValue(2);
+	QCOMPARE(box1.currentIndex(), 1);
+	QCOMPARE(box2.currentIndex(), 0);
+
+	box2.setListElements(otherElements);
+	QCOMPARE(box2.model(), otherModel.data());
+	QCOMPARE(box1.model(), model.data());
+	QCOMPARE(box1.currentValue(), QVariant{2});
+}
+
+void SelectComboBoxTest::testFilterPopup()
+{
+	SelectComboBox box;
+	box.setListElements({
+		element(QStringLiteral("One"), 1),
+		element(QStringLiteral("Two"), 2),
+		element(QStringLiteral("Three"), 3)
+	});
+	QVERIFY(!box.isEditable());
+
+	box.setFilterPopup(true);
+	QVERIFY(box.hasFilterPopup());
+	// editable only to type a filter
+	QVERIFY(box.isEditable());
+	QVERIFY(box.lineEdit());
+	QVERIFY(box.completer());
+	QCOMPARE(box.completer()->model(), box.model());
+
+	box.setCurrentValue(2);
+	QCOMPARE(box.currentIndex(), 1);
+	QCOMPARE(box.currentValue(), QVariant{2});
+
+	// values that are not elements are rejected
+	box.setCurrentValue(42);
+	QCOMPARE(box.currentIndex(), 1);
+	QCOMPARE(box.currentValue(), QVariant{2});
+
+	// the filter text is never the value
+	box.lineEdit()->setText(QStringLiteral("thr"));
+	QCOMPARE(box.currentValue(), QVariant{2});
+	emit box.lineEdit()->editingFinished();
+	QCOMPARE(box.currentText(), QStringLiteral("Two"));
+	QCOMPARE(box.currentValue(), QVariant{2});
+	QCOMPARE(box.count(), 3);
+
+	box.setFilterPopup(false);
+	QVERIFY(!box.hasFilterPopup());
+	QVERIFY(!box.isEditable());
+	QCOMPARE(box.currentValue(), QVariant{2});
+}
+
+void SelectComboBoxTest::testFilterPopupEditable()
+{
+	SelectComboBox box;
+	box.setEditable(true);
+	box.setListElements({
+		element(QStringLiteral("One"), 1),
+		element(QStringLiteral("Two"), 2)
+	});
+
+	box.setFilterPopup(true);
+	QVERIFY(box.isEditable());
+
+	// editable boxes still accept custom values, but never insert them
+	box.setCurrentValue(QStringLiteral("custom"));
+	QCOMPARE(box.currentValue(), QVariant{QStringLiteral("custom")});
+	QCOMPARE(box.count(), 2);
+
+	box.setCurrentValue(2);
+	QCOMPARE(box.currentIndex(), 1);
+	QCOMPARE(box.currentValue(), QVariant{2});
+
+	box.setFilterPopup(false);
+	QVERIFY(box.isEditable());
+}
+
+QVariantMap SelectComboBoxTest::element(const QString &name, const QVariant &value)
+{
+	return {
+		{QStringLiteral("name"), name},
+		{QStringLiteral("value"), value}
+	};
+}
+
+QTEST_MAIN(SelectComboBoxTest)
+
+#include "tst_selectcombobox.moc"
@@ -4,6 +4,11 @@ SUBDIRS += \
 	qmlsettingsgenerator \
 	qmlmvvmcore
 
+qtHaveModule(quick) {
+	SUBDIRS += \
+		qmlmvvmquick
+}
+
 equals(MSVC_VER, 14.0): SUBDIRS -= qmlsettingsgenerator
 
 prepareRecursiveTarget(run-tests)
@@ -0,0 +1,19 @@
+TEMPLATE = app
+
+QT += testlib mvvmquick qml
+CONFIG += qmltestcase console
+CONFIG -= app_bundle
+
+TARGET = tst_qmlmvvmquick
+
+SOURCES += \
+	tst_qmlmvvmquick.cpp
+
+DISTFILES += \
+	tst_qmlmvvmquick.qml
+
+importFiles.path = .
+DEPLOYMENT += importFiles
+
+win32:msvc:CONFIG(debug, debug|release): CONFIG += disable_testrun
+include(../../testrun.pri)
@@ -0,0 +1,4 @@
+#include <QtCore>
+#include <QtQuickTest/quicktest.h>
+
+QUICK_TEST_MAIN(qmlmvvmquick)
@@ -0,0 +1,127 @@
+import QtQuick 2.10
+import de.skycoder42.QtMvvm.Quick 1.1
+import QtTest 1.1
+
+Item {
+	id: root
+
+	TestCase {
+		name: "ListElementsModel"
+
+		ListElementsModel {
+			id: listModel
+		}
+
+		function init() {
+			listModel.filterText = "";
+			listModel.listElements = [
+				"baum",
+				{ name: "One", value: 1 },
+				{ name: "Two", value: 2 },
+				{ name: "Three", value: 3 },
+				{ name: "Other one", value: 1 }
+			];
+		}
+
+		function test_1_Elements() {
+			compare(listModel.count, 5);
+			compare(listModel.elementCount, 5);
+			compare(listModel.nameAt(0), "baum");
+			compare(listModel.valueAt(0), "baum");
+			compare(listModel.nameAt(1), "One");
+			compare(listModel.valueAt(1), 1);
+			compare(listModel.nameAt(5), "");
+			compare(listModel.valueAt(-1), undefined);
+
+			compare(listModel.indexOf("baum"), 0);
+			compare(listModel.indexOf(2), 2);
+			// the first element with a value is found
+			compare(listModel.indexOf(1), 1);
+			compare(listModel.nameOf(1), "One");
+			compare(listModel.indexOf(4), -1);
+			compare(listModel.indexOf("One"), -1);
+			compare(listModel.nameOf(4), "");
+		}
+
+		function test_2_IndexOfFiltered() {
+			listModel.filterText = "t";
+			compare(listModel.count, 3);
+			compare(listModel.elementCount, 5);
+			compare(listModel.nameAt(0), "Two");
+			compare(listModel.nameAt(1), "Three");
+			compare(listModel.nameAt(2), "Other one");
+
+			// rows of the filtered model
+			compare(listModel.indexOf(2), 0);
+			compare(listModel.indexOf(3), 1);
+			compare(listModel.valueAt(listModel.indexOf(3)), 3);
+			// the first element with the value is filtered out
+			compare(listModel.indexOf(1), -1);
+			compare(listModel.indexOf("baum"), -1);
+
+			listModel.filterText = "";
+			compare(listModel.count, 5);
+			compare(listModel.indexOf(3), 3);
+		}
+
+		function test_3_NameOfIgnoresFilter() {
+			listModel.filterText = "two";
+			compare(listModel.count, 1);
+			compare(listModel.nameOf(2), "Two");
+			compare(listModel.nameOf(3), "Three");
+			compare(listModel.nameOf("baum"), "baum");
+			compare(listModel.nameOf(1), "One");
+		}
+
+		function test_4_AmbiguousValues() {
+			// arrays have no string representation, so all of them collide
+			listModel.listElements = [
+				{ name: "A", value: [1] },
+				{ name: "B", value: [2] },
+				{ name: "C", value: [3] },
+				"baum"
+			];
+			compare(listModel.indexOf([1]), 0);
+			compare(listModel.indexOf([2]), 1);
+			compare(listModel.indexOf([3]), 2);
+			compare(listModel.nameOf([3]), "C");
+			compare(listModel.indexOf("baum"), 3);
+			compare(listModel.indexOf([4]), -1);
+
+			listModel.filterText = "c";
+			compare(listModel.indexOf([3]), 0);
+			compare(listModel.indexOf([2]), -1);
+			compare(listModel.nameOf([2]), "B");
+		}
+
+		SignalSpy {
+			id: countSpy
+			target: listModel
+			signalName: "countChanged"
+		}
+
+		function test_5_SetElementsWhileFiltered() {
+			listModel.filterText = "o";
+			compare(listModel.count, 3);
+			compare(listModel.indexOf(1), 0);
+
+			countSpy.clear();
+			listModel.listElements = [
+				{ name: "Four", value: 4 },
+				{ name: "Five", value: 5 },
+				{ name: "Six", value: 6 },
+				{ name: "Zero", value: 0 }
+			];
+			compare(countSpy.count, 1);
+			compare(listModel.filterText, "o");
+			compare(listModel.elementCount, 4);
+			compare(listModel.count, 2);
+			compare(listModel.nameAt(0), "Four");
+			compare(listModel.nameAt(1), "Zero");
+			compare(listModel.indexOf(0), 1);
+			compare(listModel.indexOf(5), -1);
+			compare(listModel.indexOf(1), -1);
+			compare(listModel.nameOf(5), "Five");
+		}
+	}
+}
@@ -22,6 +22,24 @@ Item {
 		}
 	}
 
+	SignalSpy {
+		id: insertSpy
+		target: TestSettings.modelNode
+		signalName: "rowsInserted"
+	}
+
+	SignalSpy {
+		id: removeSpy
+		target: TestSettings.modelNode
+		signalName: "rowsRemoved"
+	}
+
+	SignalSpy {
+		id: changeSpy
+		target: TestSettings.modelNode
+		signalName: "dataChanged"
+	}
+
 	TestCase {
 		name: "QmlSettings"
 
@@ -100,6 +118,49 @@ Item {
 			compare(TestSettings.listNode.length, 0);
 			verify(!TestSettings.listNode[0]);
 		}
+
+		function test_4_listModel() {
+			var model = TestSettings.modelNode;
+			verify(model);
+			compare(model.rowCount(), 0);
+
+			insertSpy.clear();
+			var first = TestSettings.modelNode_push();
+			verify(first);
+			compare(model.rowCount(), 1);
+			compare(insertSpy.count, 1);
+			compare(model.at(0), first);
+			compare(first.name, "unnamed");
+			compare(first.count, 0);
+			verify(first.details);
+
+			var second = model.push();
+			verify(second);
+			compare(model.rowCount(), 2);
+			compare(insertSpy.count, 2);
+
+			var nameRole = Qt.UserRole + 1; // roles follow the entry order
+			compare(model.data(model.index(0, 0), Qt.UserRole), first);
+
+			changeSpy.clear();
+			second.name = "second";
+			compare(model.data(model.index(1, 0), nameRole), "second");
+			compare(changeSpy.count, 1);
+			verify(model.setData(model.index(0, 0), "first", nameRole));
+			compare(first.name, "first");
+			compare(changeSpy.count, 2);
+
+			removeSpy.clear();
+			model.pop();
+			compare(model.rowCount(), 1);
+			compare(removeSpy.count, 1);
+			compare(model.at(0).name, "first");
+			verify(!model.at(1));
+
+			model.reset();
+			compare(model.rowCount(), 0);
+			compare(removeSpy.count, 2);
+		}
 	}
 
 }
@@ -0,0 +1,22 @@
+TEMPLATE = subdirs
+
+SUBDIRS += \
+	mvvmcore
+
+qtHaveModule(widgets) {
+	SUBDIRS += \
+		mvvmwidgets
+}
+
+qtHaveModule(quick) {
+	SUBDIRS += \
+		mvvmquick
+}
+
+qtHaveModule(datasync) {
+	SUBDIRS += \
+		mvvmdatasynccore
+}
+
+prepareRecursiveTarget(run-tests)
+QMAKE_EXTRA_TARGETS += run-tests
@@ -0,0 +1,9 @@
+TEMPLATE = subdirs
+
+SUBDIRS += \
+	qsettingsaccessor \
+	snapshotsettingsaccessor \
+	settingsconfigloader
+
+prepareRecursiveTarget(run-tests)
+QMAKE_EXTRA_TARGETS += run-tests
@@ -0,0 +1,16 @@
+TEMPLATE = app
+
+QT += testlib mvvmcore
+QT -= gui
+CONFIG += console
+CONFIG -= app_bundle
+
+TARGET = tst_bench_qsettingsaccessor
+
+HEADERS += \
+	../../../shared/bench_isettingsaccessor.h
+
+SOURCES += \
+	tst_bench_qsettingsaccessor.cpp
+
+include(../../../auto/testrun.pri)
@@ -0,0 +1,32 @@
+#include <QtTest>
+#include <QtMvvmCore/QSettingsAccessor>
+#include "../../../shared/bench_isettingsaccessor.h"
+using namespace QtMvvm;
+
+class QSettingsAccessorBenchmark : public ISettingsAccessorBenchmark
+{
+	Q_OBJECT
+
+protected:
+	ISettingsAccessor *createAccessor() override;
+
+private:
+	QTemporaryDir tDir;
+	int fileCounter = 0;
+};
+
+ISettingsAccessor *QSettingsAccessorBenchmark::createAccessor()
+{
+	// a new file for every benchmark, so each one starts with empty settings
+	auto settings = new QSettings{
+		tDir.filePath(QStringLiteral("settings%1.ini").arg(fileCounter++)),
+		QSettings::IniFormat
+	};
+	auto accessor = new QSettingsAccessor{settings, this};
+	settings->setParent(accessor);
+	return accessor;
+}
+
+QTEST_MAIN(QSettingsAccessorBenchmark)
+
+#include "tst_bench_qsettingsaccessor.moc"
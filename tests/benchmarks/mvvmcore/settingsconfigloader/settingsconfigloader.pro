@@ -0,0 +1,25 @@
+TEMPLATE = app
+
+QT += testlib mvvmcore mvvmcore-private
+QT -= gui
+CONFIG += console
+CONFIG -= app_bundle
+
+TARGET = tst_bench_settingsconfigloader
+
+INCLUDEPATH += \
+	../../../../src/settingsconfig \
+	$$shadowed(../../../../src/mvvmcore) \
+	../../../../src/3rdparty/optional-lite \
+	../../../../src/3rdparty/variant-lite
+
+CONFIG(release, debug|release): INCLUDEPATH += $$shadowed(../../../../src/mvvmcore/release)
+else:CONFIG(debug, debug|release): INCLUDEPATH += $$shadowed(../../../../src/mvvmcore/debug)
+
+HEADERS += \
+	../../../shared/syntheticsettings.h
+
+SOURCES += \
+	tst_bench_settingsconfigloader.cpp
+
+include(../../../auto/testrun.pri)
@@ -0,0 +1,145 @@
+#include <QtTest>
+#include <QtMvvmCore/private/settingsconfigloader_p.h>
+#include "../../../shared/syntheticsettings.h"
+using namespace QtMvvm;
+using namespace QtMvvm::SettingsElements;
+
+class SettingsConfigLoaderBenchmark : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void initTestCase();
+
+	void benchLoadCold_data();
+	void benchLoadCold();
+	void benchLoadWarm_data();
+	void benchLoadWarm();
+	void benchToSetup_data();
+	void benchToSetup();
+
+private:
+	QTemporaryDir tDir;
+	QHash<int, QString> documents;
+
+	void addSizeColumns();
+	static int entryCount(const Setup &setup);
+};
+
+void SettingsConfigLoaderBenchmark::initTestCase()
+{
+	QVERIFY(tDir.isValid());
+	for(auto count : {100, 1000, 10000})
+		documents.insert(count, SyntheticSettings::generate(tDir.path(), count));
+}
+
+void SettingsConfigLoaderBenchmark::benchLoadCold_data()
+{
+	QTest::addColumn<int>("count");
+	QTest::addColumn<bool>("selected");
+
+	for(auto count : {100, 1000, 10000}) {
+		QTest::addRow("plain-%d", count) << count << false;
+		QTest::addRow("selected-%d", count) << count << true;
+	}
+}
+
+void SettingsConfigLoaderBenchmark::benchLoadCold()
+{
+	QFETCH(int, count);
+	QFETCH(bool, selected);
+
+	QFileSelector selector;
+	if(selected)
+		selector.setExtraSelectors({SyntheticSettings::selector()});
+
+	// a new loader for every run, so nothing is cached
+	Setup setup;
+	try {
+		QBENCHMARK {
+			SettingsConfigLoader loader;
+			setup = loader.loadSetup(documents.value(count), QStringLiteral("widgets"), &selector);
+		}
+	} catch(std::exception &e) {
+		QFAIL(e.what());
+	}
+	QCOMPARE(setup.categories.size(), SyntheticSettings::categoryCount(count));
+	if(selected)
+		QCOMPARE(entryCount(setup), count);
+	else
+		QVERIFY(entryCount(setup) < count);
+}
+
+void SettingsConfigLoaderBenchmark::benchLoadWarm_data()
+{
+	addSizeColumns();
+}
+
+void SettingsConfigLoaderBenchmark::benchLoadWarm()
+{
+	QFETCH(int, count);
+
+	QFileSelector selector;
+	selector.setExtraSelectors({SyntheticSettings::selector()});
+
+	try {
+		SettingsConfigLoader loader;
+		auto flat = loader.loadFlatSetup(documents.value(count), QStringLiteral("widgets"), &selector);
+		QBENCHMARK {
+			flat = loader.loadFlatSetup(documents.value(count), QStringLiteral("widgets"), &selector);
+		}
+		QCOMPARE(flat.entryCount(), count);
+	} catch(std::exception &e) {
+		QFAIL(e.what());
+	}
+}
+
+void SettingsConfigLoaderBenchmark::benchToSetup_data()
+{
+	addSizeColumns();
+}
+
+void SettingsConfigLoaderBenchmark::benchToSetup()
+{
+	QFETCH(int, count);
+
+	QFileSelector selector;
+	selector.setExtraSelectors({SyntheticSettings::selector()});
+
+	// loadSetup on a warm cache, i.e. the cost of converting the cached flat setup for older callers
+	try {
+		SettingsConfigLoader loader;
+		auto setup = loader.loadSetup(documents.value(count), QStringLiteral("widgets"), &selector);
+		QBENCHMARK {
+			setup = loader.loadSetup(documents.value(count), QStringLiteral("widgets"), &selector);
+		}
+		QCOMPARE(entryCount(setup), count);
+	} catch(std::exception &e) {
+		QFAIL(e.what());
+	}
+}
+
+void SettingsConfigLoaderBenchmark::addSizeColumns()
+{
+	QTest::addColumn<int>("count");
+
+	QTest::newRow("100") << 100;
+	QTest::newRow("1000") << 1000;
+	QTest::newRow("10000") << 10000;
+}
+
+int SettingsConfigLoaderBenchmark::entryCount(const Setup &setup)
+{
+	auto count = 0;
+	for(const auto &category : setup.categories) {
+		for(const auto &section : category.sections) {
+			for(const auto &group : section.groups)
+				count += group.entries.size();
+		}
+	}
+	return count;
+}
+
+QTEST_MAIN(SettingsConfigLoaderBenchmark)
+
+#include "tst_bench_settingsconfigloader.moc"
@@ -0,0 +1,31 @@
+#include <QtTest>
+#include <QtMvvmCore/QSettingsAccessor>
+#include <QtMvvmCore/SnapshotSettingsAccessor>
+#include "../../../shared/bench_isettingsaccessor.h"
+using namespace QtMvvm;
+
+class SnapshotSettingsAccessorBenchmark : public ISettingsAccessorBenchmark
+{
+	Q_OBJECT
+
+protected:
+	ISettingsAccessor *createAccessor() override;
+
+private:
+	QTemporaryDir tDir;
+	int fileCounter = 0;
+};
+
+ISettingsAccessor *SnapshotSettingsAccessorBenchmark::createAccessor()
+{
+	// same backend as the QSettingsAccessor benchmark, so the overhead of the snapshots is visible
+	auto settings = new QSettings{
+		tDir.filePath(QStringLiteral("settings%1.ini").arg(fileCounter++)),
+		QSettings::IniFormat
+	};
+	return new SnapshotSettingsAccessor{new QSettingsAccessor{settings}, this};
+}
+
+QTEST_MAIN(SnapshotSettingsAccessorBenchmark)
+
+#include "tst_bench_snapshotsettingsaccessor.moc"
@@ -0,0 +1,16 @@
+TEMPLATE = app
+
+QT += testlib mvvmdatasynccore
+QT -= gui
+CONFIG += console
+CONFIG -= app_bundle
+
+TARGET = tst_bench_datasyncsettingsaccessor
+
+HEADERS += \
+	../../../shared/bench_isettingsaccessor.h
+
+SOURCES += \
+	tst_bench_datasyncsettingsaccessor.cpp
+
+include(../../../auto/testrun.pri)
@@ -0,0 +1,53 @@
+#include <QtTest>
+#include <QtMvvmDataSyncCore/DataSyncSettingsAccessor>
+#include <QtDataSync/Setup>
+#include "../../../shared/bench_isettingsaccessor.h"
+using namespace QtDataSync;
+using namespace QtMvvm;
+
+class DataSyncSettingsAccessorBenchmark : public ISettingsAccessorBenchmark
+{
+	Q_OBJECT
+
+protected:
+	ISettingsAccessor *createAccessor() override;
+	void destroyAccessor(ISettingsAccessor *accessor) override;
+
+private Q_SLOTS:
+	void initTestCase();
+	void cleanupTestCase();
+
+private:
+	QTemporaryDir tDir;
+};
+
+ISettingsAccessor *DataSyncSettingsAccessorBenchmark::createAccessor()
+{
+	return new DataSyncSettingsAccessor{this};
+}
+
+void DataSyncSettingsAccessorBenchmark::destroyAccessor(ISettingsAccessor *accessor)
+{
+	// all accessors share the same store, so it must be cleared for the next benchmark
+	accessor->remove(QStringLiteral("bench"));
+	accessor->remove(QStringLiteral("list"));
+	accessor->remove(QStringLiteral("tree"));
+	delete accessor;
+}
+
+void DataSyncSettingsAccessorBenchmark::initTestCase()
+{
+	Setup{}.setLocalDir(tDir.path())
+			.setKeyStoreProvider(QStringLiteral("plain"))
+			.create();
+}
+
+void DataSyncSettingsAccessorBenchmark::cleanupTestCase()
+{
+	Setup::removeSetup(DefaultSetup, true);
+	tDir.remove();
+}
+
+QTEST_MAIN(DataSyncSettingsAccessorBenchmark)
+
+#include "tst_bench_datasyncsettingsaccessor.moc"
@@ -0,0 +1,15 @@
+TEMPLATE = app
+
+QT += testlib mvvmdatasynccore mvvmdatasynccore-private
+CONFIG += console
+CONFIG -= app_bundle
+
+TARGET = tst_bench_datasyncviewmodels
+
+HEADERS += \
+	../../../shared/fakedatasyncbackend.h
+
+SOURCES += \
+	tst_bench_datasyncviewmodels.cpp
+
+include(../../../auto/testrun.pri)
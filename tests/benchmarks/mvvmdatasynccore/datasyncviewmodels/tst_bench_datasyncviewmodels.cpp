@@ -0,0 +1,265 @@
+#include <QtTest>
+#include <QtMvvmDataSyncCore/DataSyncViewModel>
+#include <QtMvvmDataSyncCore/NetworkExchangeViewModel>
+#include <QtMvvmDataSyncCore/private/changeremoteviewmodel_p.h>
+#include "../../../shared/fakedatasyncbackend.h"
+using namespace QtMvvm;
+using namespace QtDataSync;
+
+class DataSyncViewModelsBenchmark : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void initTestCase();
+
+	void benchDeviceListUpdate_data();
+	void benchDeviceListUpdate();
+	void benchDeviceChurn_data();
+	void benchDeviceChurn();
+	void benchSort_data();
+	void benchSort();
+	void benchFilter_data();
+	void benchFilter();
+	void benchStateChanges_data();
+	void benchStateChanges();
+	void benchRefreshRate_data();
+	void benchRefreshRate();
+
+	void benchExchangeAnnounce();
+	void benchRemoteHeaders();
+
+private:
+	static const int VisibleRows = 40;
+
+	void addSizeColumns();
+	// reads all roles of the first rows, like a view does after a model update
+	int readViewport(QAbstractItemModel *model);
+};
+
+void DataSyncViewModelsBenchmark::initTestCase()
+{
+	qRegisterMetaType<QList<DeviceInfo>>();
+	qRegisterMetaType<QList<UserInfo>>();
+	qRegisterMetaType<SyncManager::SyncState>();
+}
+
+void DataSyncViewModelsBenchmark::benchDeviceListUpdate_data()
+{
+	addSizeColumns();
+}
+
+void DataSyncViewModelsBenchmark::benchDeviceListUpdate()
+{
+	QFETCH(int, count);
+
+	DataSyncViewModel viewModel;
+	FakeAccountManager accountManager;
+	accountManager.attach(viewModel.accountModel());
+	accountManager.generateDevices(count);
+	viewModel.sortedModel()->sort(0);
+
+	QBENCHMARK {
+		accountManager.listDevices();
+	}
+	QCOMPARE(viewModel.sortedModel()->rowCount(), count);
+}
+
+void DataSyncViewModelsBenchmark::benchDeviceChurn_data()
+{
+	addSizeColumns();
+}
+
+void DataSyncViewModelsBenchmark::benchDeviceChurn()
+{
+	QFETCH(int, count);
+
+	DataSyncViewModel viewModel;
+	FakeAccountManager accountManager;
+	accountManager.attach(viewModel.accountModel());
+	accountManager.generateDevices(count);
+	accountManager.listDevices();
+	viewModel.sortedModel()->sort(0);
+
+	QBENCHMARK {
+		accountManager.churnDevices(10);
+		accountManager.listDevices();
+	}
+	QCOMPARE(viewModel.sortedModel()->rowCount(), accountManager.devices().size());
+}
+
+void DataSyncViewModelsBenchmark::benchSort_data()
+{
+	QTest::addColumn<int>("count");
+	QTest::addColumn<int>("column");
+
+	for(auto count : {100, 1000, 10000}) {
+		QTest::addRow("name-%d", count) << count << 0;
+		QTest::addRow("fingerprint-%d", count) << count << 1;
+	}
+}
+
+void DataSyncViewModelsBenchmark::benchSort()
+{
+	QFETCH(int, count);
+	QFETCH(int, column);
+
+	DataSyncViewModel viewModel;
+	FakeAccountManager accountManager;
+	accountManager.attach(viewModel.accountModel());
+	accountManager.generateDevices(count);
+	accountManager.listDevices();
+
+	auto order = Qt::AscendingOrder;
+	QBENCHMARK {
+		viewModel.sortedModel()->sort(column, order);
+		order = order == Qt::AscendingOrder ? Qt::DescendingOrder : Qt::AscendingOrder;
+	}
+	QCOMPARE(viewModel.sortedModel()->rowCount(), count);
+}
+
+void DataSyncViewModelsBenchmark::benchFilter_data()
+{
+	addSizeColumns();
+}
+
+void DataSyncViewModelsBenchmark::benchFilter()
+{
+	QFETCH(int, count);
+
+	DataSyncViewModel viewModel;
+	FakeAccountManager accountManager;
+	accountManager.attach(viewModel.accountModel());
+	accountManager.generateDevices(count);
+	accountManager.listDevices();
+	viewModel.sortedModel()->sort(0);
+	viewModel.sortedModel()->setFilterKeyColumn(1);
+
+	const QStringList patterns {
+		QStringLiteral("A"),
+		QStringLiteral("A1"),
+		QStringLiteral("A1:"),
+		QString()
+	};
+	QBENCHMARK {
+		for(const auto &pattern : patterns)
+			viewModel.sortedModel()->setFilterFixedString(pattern);
+	}
+	QCOMPARE(viewModel.sortedModel()->rowCount(), count);
+}
+
+void DataSyncViewModelsBenchmark::benchStateChanges_data()
+{
+	QTest::addColumn<int>("count");
+	QTest::addColumn<bool>("reconnect");
+
+	for(auto count : {100, 1000, 10000}) {
+		QTest::addRow("sync-%d", count) << count << false;
+		QTest::addRow("reconnect-%d", count) << count << true;
+	}
+}
+
+void DataSyncViewModelsBenchmark::benchStateChanges()
+{
+	QFETCH(int, count);
+	QFETCH(bool, reconnect);
+
+	DataSyncViewModel viewModel;
+	FakeSyncManager syncManager;
+	FakeAccountManager accountManager;
+	syncManager.attach(viewModel.accountModel());
+	accountManager.attach(viewModel.accountModel());
+	accountManager.generateDevices(count);
+	accountManager.listDevices();
+	viewModel.sortedModel()->sort(0);
+
+	QBENCHMARK {
+		for(auto i = 0; i < 100; i++) {
+			if(reconnect) {
+				syncManager.reconnectCycle();
+				accountManager.listDevices(); //done by the real account manager after the reload
+			} else
+				syncManager.syncCycle();
+		}
+	}
+	QCOMPARE(viewModel.sortedModel()->rowCount(), count);
+}
+
+void DataSyncViewModelsBenchmark::benchRefreshRate_data()
+{
+	addSizeColumns();
+}
+
+void DataSyncViewModelsBenchmark::benchRefreshRate()
+{
+	QFETCH(int, count);
+
+	DataSyncViewModel viewModel;
+	FakeAccountManager accountManager;
+	accountManager.attach(viewModel.accountModel());
+	accountManager.generateDevices(count);
+	accountManager.listDevices();
+	viewModel.sortedModel()->sort(0);
+
+	// one iteration equals one frame: a device update followed by a repaint of the visible rows
+	QBENCHMARK {
+		accountManager.churnDevices(1);
+		accountManager.listDevices();
+		QVERIFY(readViewport(viewModel.sortedModel()) > 0);
+	}
+}
+
+void DataSyncViewModelsBenchmark::benchExchangeAnnounce()
+{
+	NetworkExchangeViewModel viewModel;
+	FakeUserExchangeManager exchangeManager;
+	exchangeManager.attach(viewModel.deviceModel());
+	exchangeManager.setDevices({UserInfo{}});
+	viewModel.sortedModel()->sort(0);
+
+	QBENCHMARK {
+		exchangeManager.announce();
+	}
+	QCOMPARE(viewModel.sortedModel()->rowCount(), 1);
+}
+
+void DataSyncViewModelsBenchmark::benchRemoteHeaders()
+{
+	ChangeRemoteViewModel viewModel;
+	QBENCHMARK {
+		for(auto i = 0; i < 100; i++)
+			viewModel.addHeaderConfig(QStringLiteral("key%1").arg(i), QStringLiteral("value"));
+		while(viewModel.headerModel()->rowCount() > 0)
+			viewModel.removeHeaderConfig(0);
+	}
+}
+
+void DataSyncViewModelsBenchmark::addSizeColumns()
+{
+	QTest::addColumn<int>("count");
+
+	QTest::newRow("100") << 100;
+	QTest::newRow("1000") << 1000;
+	QTest::newRow("10000") << 10000;
+}
+
+int DataSyncViewModelsBenchmark::readViewport(QAbstractItemModel *model)
+{
+	auto rows = qMin(VisibleRows, model->rowCount());
+	auto roles = model->roleNames().keys();
+	auto read = 0;
+	for(auto row = 0; row < rows; row++) {
+		for(auto column = 0; column < model->columnCount(); column++) {
+			auto index = model->index(row, column);
+			for(auto role : roles) {
+				if(model->data(index, role).isValid())
+					read++;
+			}
+		}
+	}
+	return read;
+}
+
+QTEST_MAIN(DataSyncViewModelsBenchmark)
+
+#include "tst_bench_datasyncviewmodels.moc"
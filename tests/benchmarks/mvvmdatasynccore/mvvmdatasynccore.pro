@@ -0,0 +1,8 @@
+TEMPLATE = subdirs
+
+SUBDIRS += \
+	datasyncviewmodels \
+	datasyncsettingsaccessor
+
+prepareRecursiveTarget(run-tests)
+QMAKE_EXTRA_TARGETS += run-tests
@@ -0,0 +1,8 @@
+TEMPLATE = subdirs
+
+SUBDIRS += \
+	settingsuibuilder \
+	qmlbinding
+
+prepareRecursiveTarget(run-tests)
+QMAKE_EXTRA_TARGETS += run-tests
@@ -0,0 +1,22 @@
+TEMPLATE = app
+
+QT += testlib qml mvvmcore
+CONFIG += console
+CONFIG -= app_bundle
+
+TARGET = tst_bench_qmlbinding
+
+# the MvvmBinding type is part of the qml plugin, so it is compiled in directly
+PLUGIN_DIR = ../../../../src/imports/mvvmcore
+INCLUDEPATH += $$PLUGIN_DIR
+
+HEADERS += \
+	../../../shared/benchbindingobject.h \
+	../../../shared/allocationcounter.h \
+	$$PLUGIN_DIR/qqmlmvvmbinding.h
+
+SOURCES += \
+	tst_bench_qmlbinding.cpp \
+	$$PLUGIN_DIR/qqmlmvvmbinding.cpp
+
+include(../../../auto/testrun.pri)
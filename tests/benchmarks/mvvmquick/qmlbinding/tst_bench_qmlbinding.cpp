@@ -0,0 +1,338 @@
+#include <QtTest>
+#include <QtQml>
+#include <qqmlmvvmbinding.h>
+#include "../../../shared/benchbindingobject.h"
+#include "../../../shared/allocationcounter.h"
+using namespace QtMvvm;
+
+class QmlBindingBenchmark : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void initTestCase();
+	void cleanupTestCase();
+
+	void benchSetup_data();
+	void benchSetup();
+	void benchToView_data();
+	void benchToView();
+	void benchToViewModel_data();
+	void benchToViewModel();
+	void benchTeardown_data();
+	void benchTeardown();
+	void benchMemory_data();
+	void benchMemory();
+	void benchStress_data();
+	void benchStress();
+
+private:
+	static const int SetupCount = 1000;
+	static const int ChangeCount = 1000;
+	static const int TeardownCount = 10000;
+
+	QQmlEngine *engine = nullptr;
+	QQmlComponent *viewComponent = nullptr;
+	QHash<QByteArray, QQmlComponent*> bindingComponents;
+
+	void addSignalColumns();
+	void addTypeColumns(const char *oneWayType);
+	QQmlComponent *bindingComponent(const QByteArray &type, bool explicitSignals);
+	void createViews(QObject *parent, QVector<QObject*> &views, int count);
+	// creates the binding as child of the view, so the view is detected like in a qml document
+	QQmlMvvmBinding *createBinding(QQmlComponent *component, BenchBindingObject *viewModel, QObject *view);
+	static void flushDeletions();
+};
+
+void QmlBindingBenchmark::initTestCase()
+{
+	qmlRegisterType<QQmlMvvmBinding>("QtMvvm.Bench", 1, 0, "MvvmBinding");
+	engine = new QQmlEngine{this};
+	viewComponent = new QQmlComponent{engine, this};
+	viewComponent->setData("import QtQml 2.2\n"
+						   "QtObject {\n"
+						   "	property int value: 0\n"
+						   "}\n", {});
+	QVERIFY2(viewComponent->isReady(), qUtf8Printable(viewComponent->errorString()));
+}
+
+void QmlBindingBenchmark::cleanupTestCase()
+{
+	qDeleteAll(bindingComponents);
+	bindingComponents.clear();
+}
+
+void QmlBindingBenchmark::benchSetup_data()
+{
+	addSignalColumns();
+}
+
+void QmlBindingBenchmark::benchSetup()
+{
+	QFETCH(bool, explicitSignals);
+
+	BenchBindingObject viewModel;
+	QObject parent;
+	QVector<QObject*> views;
+	createViews(&parent, views, SetupCount);
+	auto component = bindingComponent("TwoWay", explicitSignals);
+
+	// covers the whole qml path: object creation, property assignment and the QtMvvm::bind call
+	QVector<QQmlMvvmBinding*> bindings;
+	QBENCHMARK {
+		for(auto view : qAsConst(views))
+			bindings.append(createBinding(component, &viewModel, view));
+	}
+	QVERIFY(bindings.last()->isValid());
+
+	for(auto binding : qAsConst(bindings)) {
+		binding->unbind();
+		delete binding;
+	}
+	flushDeletions();
+}
+
+void QmlBindingBenchmark::benchToView_data()
+{
+	addTypeColumns("OneWayToView");
+}
+
+void QmlBindingBenchmark::benchToView()
+{
+	QFETCH(QByteArray, type);
+
+	BenchBindingObject viewModel;
+	QObject parent;
+	QVector<QObject*> views;
+	createViews(&parent, views, 1);
+	auto binding = createBinding(bindingComponent(type, false), &viewModel, views.first());
+	QVERIFY(binding->isValid());
+
+	// one iteration are ChangeCount changes, so the latency of a single change is the result / ChangeCount
+	QBENCHMARK {
+		for(auto i = 1; i <= ChangeCount; i++)
+			viewModel.setValue(i);
+		viewModel.setValue(0);
+	}
+	QCOMPARE(views.first()->property("value").toInt(), 0);
+}
+
+void QmlBindingBenchmark::benchToViewModel_data()
+{
+	addTypeColumns("OneWayToViewModel");
+}
+
+void QmlBindingBenchmark::benchToViewModel()
+{
+	QFETCH(QByteArray, type);
+
+	BenchBindingObject viewModel;
+	QObject parent;
+	QVector<QObject*> views;
+	createViews(&parent, views, 1);
+	auto binding = createBinding(bindingComponent(type, false), &viewModel, views.first());
+	QVERIFY(binding->isValid());
+
+	// written through QQmlProperty, like a qml assignment would
+	QQmlProperty property{views.first(), QStringLiteral("value")};
+	QBENCHMARK {
+		for(auto i = 1; i <= ChangeCount; i++)
+			property.write(i);
+		property.write(0);
+	}
+	QCOMPARE(viewModel.value(), 0);
+}
+
+void QmlBindingBenchmark::benchTeardown_data()
+{
+	QTest::addColumn<bool>("destroyViewModel");
+
+	QTest::newRow("unbind") << false;
+	QTest::newRow("destroy-viewmodel") << true;
+}
+
+void QmlBindingBenchmark::benchTeardown()
+{
+	QFETCH(bool, destroyViewModel);
+
+	QObject parent;
+	QVector<QObject*> views;
+	createViews(&parent, views, TeardownCount);
+	auto component = bindingComponent("TwoWay", false);
+
+	// the bindings have to be recreated for every run, so the time is taken manually
+	static const int Runs = 5;
+	qint64 elapsed = 0;
+	for(auto run = 0; run < Runs; run++) {
+		QScopedPointer<BenchBindingObject> viewModel{new BenchBindingObject{}};
+		QVector<QQmlMvvmBinding*> bindings;
+		bindings.reserve(TeardownCount);
+		for(auto view : qAsConst(views))
+			bindings.append(createBinding(component, viewModel.data(), view));
+
+		QElapsedTimer timer;
+		timer.start();
+		if(destroyViewModel)
+			viewModel.reset();
+		// destroying the qml object alone does not remove the binding, just like with a Binding handle
+		for(auto binding : qAsConst(bindings)) {
+			binding->unbind();
+			delete binding;
+		}
+		flushDeletions();
+		elapsed += timer.nsecsElapsed();
+	}
+	QTest::setBenchmarkResult(elapsed / (Runs * 1000000.0), QTest::WalltimeMilliseconds);
+}
+
+void QmlBindingBenchmark::benchMemory_data()
+{
+	addTypeColumns("OneWayToView");
+}
+
+void QmlBindingBenchmark::benchMemory()
+{
+	QFETCH(QByteArray, type);
+
+	BenchBindingObject viewModel;
+	QObject parent;
+	QVector<QObject*> views;
+	createViews(&parent, views, TeardownCount);
+	auto component = bindingComponent(type, false);
+	QVector<QQmlMvvmBinding*> bindings;
+	bindings.reserve(TeardownCount);
+
+	// warm up the engine caches and connection lists, they are not part of a binding
+	auto warmup = createBinding(component, &viewModel, views.first());
+	warmup->unbind();
+	delete warmup;
+	flushDeletions();
+
+	// includes the MvvmBinding object itself, as it lives as long as the binding in a qml document
+	const auto before = AllocationCounter::current();
+	for(auto view : qAsConst(views))
+		bindings.append(createBinding(component, &viewModel, view));
+	const auto after = AllocationCounter::current();
+	QTest::setBenchmarkResult(static_cast<qreal>(after - before) / TeardownCount, QTest::BytesAllocated);
+
+	for(auto binding : qAsConst(bindings)) {
+		binding->unbind();
+		delete binding;
+	}
+	flushDeletions();
+}
+
+void QmlBindingBenchmark::benchStress_data()
+{
+	QTest::addColumn<int>("viewCount");
+
+	QTest::newRow("10") << 10;
+	QTest::newRow("100") << 100;
+	QTest::newRow("1000") << 1000;
+}
+
+void QmlBindingBenchmark::benchStress()
+{
+	QFETCH(int, viewCount);
+
+	// a single source property that changes at a high rate, with many views bound to it
+	BenchBindingObject viewModel;
+	QObject parent;
+	QVector<QObject*> views;
+	createViews(&parent, views, viewCount);
+	auto component = bindingComponent("TwoWay", false);
+	for(auto view : qAsConst(views))
+		createBinding(component, &viewModel, view);
+
+	QBENCHMARK {
+		for(auto i = 1; i <= ChangeCount; i++) {
+			viewModel.setValue(i);
+			// give the event loop a turn every 16 changes, like a frame would
+			if(i % 16 == 0)
+				QCoreApplication::processEvents();
+		}
+		viewModel.setValue(0);
+	}
+	QCOMPARE(views.last()->property("value").toInt(), 0);
+
+	for(auto binding : parent.findChildren<QQmlMvvmBinding*>())
+		binding->unbind();
+	flushDeletions();
+}
+
+void QmlBindingBenchmark::addSignalColumns()
+{
+	QTest::addColumn<bool>("explicitSignals");
+
+	QTest::newRow("notify") << false;
+	QTest::newRow("signals") << true;
+}
+
+void QmlBindingBenchmark::addTypeColumns(const char *oneWayType)
+{
+	QTest::addColumn<QByteArray>("type");
+
+	QTest::newRow("oneway") << QByteArray{oneWayType};
+	QTest::newRow("twoway") << QByteArrayLiteral("TwoWay");
+}
+
+QQmlComponent *QmlBindingBenchmark::bindingComponent(const QByteArray &type, bool explicitSignals)
+{
+	const auto key = type + (explicitSignals ? "/signals" : "/notify");
+	auto component = bindingComponents.value(key);
+	if(component)
+		return component;
+
+	QByteArray data = "import QtMvvm.Bench 1.0\n"
+					  "MvvmBinding {\n"
+					  "	viewModel: benchViewModel\n"
+					  "	viewModelProperty: \"value\"\n"
+					  "	viewProperty: \"value\"\n"
+					  "	type: MvvmBinding." + type + "\n";
+	if(explicitSignals) {
+		data += "	viewModelChangeSignal: \"valueUpdated()\"\n"
+				"	viewChangeSignal: \"valueChanged()\"\n";
+	}
+	data += "}\n";
+
+	component = new QQmlComponent{engine};
+	component->setData(data, {});
+	if(!component->isReady())
+		qFatal("Failed to create binding component: %s", qUtf8Printable(component->errorString()));
+	bindingComponents.insert(key, component);
+	return component;
+}
+
+void QmlBindingBenchmark::createViews(QObject *parent, QVector<QObject *> &views, int count)
+{
+	views.reserve(count);
+	for(auto i = 0; i < count; i++) {
+		auto view = viewComponent->create();
+		view->setParent(parent);
+		views.append(view);
+	}
+}
+
+QQmlMvvmBinding *QmlBindingBenchmark::createBinding(QQmlComponent *component, BenchBindingObject *viewModel, QObject *view)
+{
+	// the context is shared by all bindings of the same viewmodel
+	auto context = viewModel->findChild<QQmlContext*>(QString{}, Qt::FindDirectChildrenOnly);
+	if(!context) {
+		context = new QQmlContext{engine, viewModel};
+		context->setContextProperty(QStringLiteral("benchViewModel"), viewModel);
+	}
+
+	auto binding = qobject_cast<QQmlMvvmBinding*>(component->beginCreate(context));
+	binding->setParent(view);
+	component->completeCreate();
+	return binding;
+}
+
+void QmlBindingBenchmark::flushDeletions()
+{
+	QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+QTEST_GUILESS_MAIN(QmlBindingBenchmark)
+
+#include "tst_bench_qmlbinding.moc"
@@ -0,0 +1,27 @@
+TEMPLATE = app
+
+QT += testlib quick mvvmquick mvvmcore-private mvvmquick-private
+CONFIG += console
+CONFIG -= app_bundle
+
+TARGET = tst_bench_settingsuibuilder
+
+# the builder and its models are part of the qml plugin, so they are compiled in directly
+PLUGIN_DIR = ../../../../src/imports/mvvmquick
+INCLUDEPATH += $$PLUGIN_DIR
+
+HEADERS += \
+	../../../shared/syntheticsettings.h \
+	$$PLUGIN_DIR/settingsuibuilder.h \
+	$$PLUGIN_DIR/settingssectionmodel.h \
+	$$PLUGIN_DIR/settingsentrymodel.h \
+	$$PLUGIN_DIR/multifilterproxymodel.h
+
+SOURCES += \
+	tst_bench_settingsuibuilder.cpp \
+	$$PLUGIN_DIR/settingsuibuilder.cpp \
+	$$PLUGIN_DIR/settingssectionmodel.cpp \
+	$$PLUGIN_DIR/settingsentrymodel.cpp \
+	$$PLUGIN_DIR/multifilterproxymodel.cpp
+
+include(../../../auto/testrun.pri)
@@ -0,0 +1,170 @@
+#include <QtTest>
+#include <QtQml/QQmlProperty>
+#include <QtQuick/QQuickItem>
+#include <QtMvvmCore/ServiceRegistry>
+#include <QtMvvmCore/SettingsViewModel>
+#include <QtMvvmQuick/QuickPresenter>
+#include <settingsuibuilder.h>
+#include "../../../shared/syntheticsettings.h"
+using namespace QtMvvm;
+
+class SettingsUiBuilderBenchmark : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void initTestCase();
+
+	void benchBuilderSetup_data();
+	void benchBuilderSetup();
+	void benchEntryModelSetup_data();
+	void benchEntryModelSetup();
+	void benchFilter_data();
+	void benchFilter();
+
+private:
+	QTemporaryDir tDir;
+	QSettings *settings = nullptr;
+	QHash<int, QString> documents;
+
+	void addSizeColumns();
+	void initViewModel(SettingsViewModel *viewModel, int count);
+	// assigns the properties like the SettingsView.qml does, which starts building the ui
+	void attachBuilder(SettingsUiBuilder *builder, QQuickItem *buildView, SettingsViewModel *viewModel);
+};
+
+void SettingsUiBuilderBenchmark::initTestCase()
+{
+	QVERIFY(tDir.isValid());
+	QuickPresenter::registerAsPresenter<QuickPresenter>();
+	settings = new QSettings{tDir.filePath(QStringLiteral("settings.ini")), QSettings::IniFormat, this};
+	for(auto count : {100, 1000, 10000})
+		documents.insert(count, SyntheticSettings::generate(tDir.path(), count));
+}
+
+void SettingsUiBuilderBenchmark::benchBuilderSetup_data()
+{
+	addSizeColumns();
+}
+
+void SettingsUiBuilderBenchmark::benchBuilderSetup()
+{
+	QFETCH(int, count);
+
+	SettingsViewModel viewModel;
+	initViewModel(&viewModel, count);
+	QQuickItem buildView;
+
+	auto sections = 0;
+	QBENCHMARK {
+		SettingsUiBuilder builder;
+		connect(&builder, &SettingsUiBuilder::presentOverview,
+				this, [&](QAbstractItemModel *model) {
+			sections = model->rowCount();
+		});
+		attachBuilder(&builder, &buildView, &viewModel);
+	}
+	QCOMPARE(sections, SyntheticSettings::sectionCount(count));
+}
+
+void SettingsUiBuilderBenchmark::benchEntryModelSetup_data()
+{
+	addSizeColumns();
+}
+
+void SettingsUiBuilderBenchmark::benchEntryModelSetup()
+{
+	QFETCH(int, count);
+
+	SettingsViewModel viewModel;
+	initViewModel(&viewModel, count);
+	const auto setup = viewModel.loadFlatSetup(QStringLiteral("quick"));
+	auto factory = QuickPresenter::getInputViewFactory();
+
+	// sets up the model for every section, like opening all sections one after another
+	SettingsEntryModel model;
+	auto rows = 0;
+	QBENCHMARK {
+		rows = 0;
+		for(auto section = 0; section < setup.sectionCount(); section++) {
+			model.setup(setup, section, &viewModel, factory);
+			rows += model.rowCount();
+		}
+	}
+	QCOMPARE(rows, count);
+}
+
+void SettingsUiBuilderBenchmark::benchFilter_data()
+{
+	QTest::addColumn<int>("count");
+	QTest::addColumn<bool>("inSection");
+
+	for(auto count : {100, 1000, 10000}) {
+		QTest::addRow("overview-%d", count) << count << false;
+		QTest::addRow("section-%d", count) << count << true;
+	}
+}
+
+void SettingsUiBuilderBenchmark::benchFilter()
+{
+	QFETCH(int, count);
+	QFETCH(bool, inSection);
+
+	SettingsViewModel viewModel;
+	initViewModel(&viewModel, count);
+	QQuickItem buildView;
+	SettingsUiBuilder builder;
+	attachBuilder(&builder, &buildView, &viewModel);
+	if(inSection)
+		builder.loadSection(0);
+
+	// typing a search term one character at a time and clearing it again
+	const QStringList patterns {
+		QStringLiteral("e"),
+		QStringLiteral("en"),
+		QStringLiteral("ent"),
+		QStringLiteral("entr"),
+		QStringLiteral("entry"),
+		QStringLiteral("entry "),
+		QStringLiteral("entry 4"),
+		QStringLiteral("entry 42"),
+		QString()
+	};
+	QBENCHMARK {
+		for(const auto &pattern : patterns)
+			builder.setFilterText(pattern);
+	}
+	QVERIFY(builder.filterText().isEmpty());
+}
+
+void SettingsUiBuilderBenchmark::addSizeColumns()
+{
+	QTest::addColumn<int>("count");
+
+	QTest::newRow("100") << 100;
+	QTest::newRow("1000") << 1000;
+	QTest::newRow("10000") << 10000;
+}
+
+void SettingsUiBuilderBenchmark::initViewModel(SettingsViewModel *viewModel, int count)
+{
+	viewModel->setSettingsSetupLoader(ServiceRegistry::instance()->service<ISettingsSetupLoader>());
+	static_cast<ViewModel*>(viewModel)->onInit(SettingsViewModel::showParams(settings, documents.value(count)));
+}
+
+void SettingsUiBuilderBenchmark::attachBuilder(SettingsUiBuilder *builder, QQuickItem *buildView, SettingsViewModel *viewModel)
+{
+	QQmlProperty::write(builder, QStringLiteral("viewModel"), QVariant::fromValue<QObject*>(viewModel));
+	QQmlProperty::write(builder, QStringLiteral("buildView"), QVariant::fromValue<QObject*>(buildView));
+}
+
+int main(int argc, char *argv[])
+{
+	// activate all selector dependent parts of the documents
+	qputenv("QT_FILE_SELECTORS", SyntheticSettings::selector().toUtf8());
+	QGuiApplication app{argc, argv};
+	SettingsUiBuilderBenchmark benchmark;
+	return QTest::qExec(&benchmark, argc, argv);
+}
+
+#include "tst_bench_settingsuibuilder.moc"
@@ -0,0 +1,16 @@
+TEMPLATE = app
+
+QT += testlib widgets mvvmcore
+CONFIG += console
+CONFIG -= app_bundle
+
+TARGET = tst_bench_binding
+
+HEADERS += \
+	../../../shared/benchbindingobject.h \
+	../../../shared/allocationcounter.h
+
+SOURCES += \
+	tst_bench_binding.cpp
+
+include(../../../auto/testrun.pri)
@@ -0,0 +1,307 @@
+#include <QtTest>
+#include <QtWidgets>
+#include <QtMvvmCore/Binding>
+#include "../../../shared/benchbindingobject.h"
+#include "../../../shared/allocationcounter.h"
+using namespace QtMvvm;
+
+class BindingBenchmark : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void benchSetup_data();
+	void benchSetup();
+	void benchToView_data();
+	void benchToView();
+	void benchToViewModel_data();
+	void benchToViewModel();
+	void benchTeardown_data();
+	void benchTeardown();
+	void benchMemory_data();
+	void benchMemory();
+	void benchStress_data();
+	void benchStress();
+
+private:
+	enum Overload {
+		ByName,
+		ByMetaProperty,
+		SignalsByName,
+		SignalsByMetaMethod
+	};
+
+	static const int SetupCount = 1000;
+	static const int ChangeCount = 1000;
+	static const int TeardownCount = 10000;
+
+	static Binding bindSpinBox(BenchBindingObject *viewModel, QSpinBox *view, Overload overload, Binding::BindingDirection type = Binding::TwoWay);
+	static void createViews(QWidget *parent, QVector<QSpinBox*> &views, int count);
+	// unbinding only schedules the deletion of the bindings
+	static void flushDeletions();
+};
+
+Q_DECLARE_METATYPE(Binding::BindingDirection)
+
+void BindingBenchmark::benchSetup_data()
+{
+	QTest::addColumn<int>("overload");
+
+	QTest::newRow("name") << static_cast<int>(ByName);
+	QTest::newRow("metaproperty") << static_cast<int>(ByMetaProperty);
+	QTest::newRow("signals-name") << static_cast<int>(SignalsByName);
+	QTest::newRow("signals-metamethod") << static_cast<int>(SignalsByMetaMethod);
+}
+
+void BindingBenchmark::benchSetup()
+{
+	QFETCH(int, overload);
+
+	BenchBindingObject viewModel;
+	QWidget parent;
+	QVector<QSpinBox*> views;
+	createViews(&parent, views, SetupCount);
+
+	// every run has to start with unbound views, so the time is taken manually and the bindings are removed between the runs
+	static const int Runs = 5;
+	qint64 elapsed = 0;
+	for(auto run = 0; run < Runs; run++) {
+		QVector<Binding> bindings;
+		bindings.reserve(SetupCount);
+
+		QElapsedTimer timer;
+		timer.start();
+		for(auto view : qAsConst(views))
+			bindings.append(bindSpinBox(&viewModel, view, static_cast<Overload>(overload)));
+		elapsed += timer.nsecsElapsed();
+		QVERIFY(bindings.last().isValid());
+
+		for(auto &binding : bindings)
+			binding.unbind();
+		flushDeletions();
+	}
+	QTest::setBenchmarkResult(elapsed / (Runs * 1000000.0), QTest::WalltimeMilliseconds);
+}
+
+void BindingBenchmark::benchToView_data()
+{
+	QTest::addColumn<Binding::BindingDirection>("type");
+
+	QTest::newRow("oneway") << Binding::BindingDirection{Binding::OneWayToView};
+	QTest::newRow("twoway") << Binding::BindingDirection{Binding::TwoWay};
+}
+
+void BindingBenchmark::benchToView()
+{
+	QFETCH(Binding::BindingDirection, type);
+
+	BenchBindingObject viewModel;
+	QSpinBox view;
+	view.setRange(0, ChangeCount);
+	auto binding = bindSpinBox(&viewModel, &view, ByName, type);
+	QVERIFY(binding);
+
+	// one iteration are ChangeCount changes, so the latency of a single change is the result / ChangeCount
+	QBENCHMARK {
+		for(auto i = 1; i <= ChangeCount; i++)
+			viewModel.setValue(i);
+		viewModel.setValue(0);
+	}
+	QCOMPARE(view.value(), 0);
+}
+
+void BindingBenchmark::benchToViewModel_data()
+{
+	QTest::addColumn<Binding::BindingDirection>("type");
+
+	QTest::newRow("oneway") << Binding::BindingDirection{Binding::OneWayToViewModel};
+	QTest::newRow("twoway") << Binding::BindingDirection{Binding::TwoWay};
+}
+
+void BindingBenchmark::benchToViewModel()
+{
+	QFETCH(Binding::BindingDirection, type);
+
+	BenchBindingObject viewModel;
+	QSpinBox view;
+	view.setRange(0, ChangeCount);
+	auto binding = bindSpinBox(&viewModel, &view, ByName, type);
+	QVERIFY(binding);
+
+	QBENCHMARK {
+		for(auto i = 1; i <= ChangeCount; i++)
+			view.setValue(i);
+		view.setValue(0);
+	}
+	QCOMPARE(viewModel.value(), 0);
+}
+
+void BindingBenchmark::benchTeardown_data()
+{
+	QTest::addColumn<bool>("destroyViewModel");
+
+	QTest::newRow("unbind") << false;
+	QTest::newRow("destroy-viewmodel") << true;
+}
+
+void BindingBenchmark::benchTeardown()
+{
+	QFETCH(bool, destroyViewModel);
+
+	QWidget parent;
+	QVector<QSpinBox*> views;
+	createViews(&parent, views, TeardownCount);
+
+	// the bindings have to be recreated for every run, so the time is taken manually
+	static const int Runs = 5;
+	qint64 elapsed = 0;
+	for(auto run = 0; run < Runs; run++) {
+		QScopedPointer<BenchBindingObject> viewModel{new BenchBindingObject{}};
+		QVector<Binding> bindings;
+		bindings.reserve(TeardownCount);
+		for(auto view : qAsConst(views))
+			bindings.append(bindSpinBox(viewModel.data(), view, ByName));
+
+		QElapsedTimer timer;
+		timer.start();
+		if(destroyViewModel)
+			viewModel.reset();
+		else {
+			for(auto &binding : bindings)
+				binding.unbind();
+		}
+		flushDeletions();
+		elapsed += timer.nsecsElapsed();
+
+		for(const auto &binding : qAsConst(bindings))
+			QVERIFY(!binding.isValid());
+	}
+	QTest::setBenchmarkResult(elapsed / (Runs * 1000000.0), QTest::WalltimeMilliseconds);
+}
+
+void BindingBenchmark::benchMemory_data()
+{
+	QTest::addColumn<Binding::BindingDirection>("type");
+
+	QTest::newRow("oneway") << Binding::BindingDirection{Binding::OneWayToView};
+	QTest::newRow("twoway") << Binding::BindingDirection{Binding::TwoWay};
+}
+
+void BindingBenchmark::benchMemory()
+{
+	QFETCH(Binding::BindingDirection, type);
+
+	BenchBindingObject viewModel;
+	QWidget parent;
+	QVector<QSpinBox*> views;
+	createViews(&parent, views, TeardownCount);
+	QVector<Binding> bindings;
+	bindings.reserve(TeardownCount);
+
+	// warm up lazily created connection lists and caches, they are not part of a binding
+	bindings.append(bindSpinBox(&viewModel, views.first(), ByName, type));
+	bindings.first().unbind();
+	flushDeletions();
+	bindings.clear();
+
+	const auto before = AllocationCounter::current();
+	for(auto view : qAsConst(views))
+		bindings.append(bindSpinBox(&viewModel, view, ByName, type));
+	const auto after = AllocationCounter::current();
+	QTest::setBenchmarkResult(static_cast<qreal>(after - before) / TeardownCount, QTest::BytesAllocated);
+
+	for(auto &binding : bindings)
+		binding.unbind();
+	flushDeletions();
+}
+
+void BindingBenchmark::benchStress_data()
+{
+	QTest::addColumn<int>("viewCount");
+
+	QTest::newRow("10") << 10;
+	QTest::newRow("100") << 100;
+	QTest::newRow("1000") << 1000;
+}
+
+void BindingBenchmark::benchStress()
+{
+	QFETCH(int, viewCount);
+
+	// a single source property that changes at a high rate, with many views bound to it
+	BenchBindingObject viewModel;
+	QWidget parent;
+	QVector<QSpinBox*> views;
+	createViews(&parent, views, viewCount);
+	QVector<Binding> bindings;
+	for(auto view : qAsConst(views))
+		bindings.append(bindSpinBox(&viewModel, view, ByName));
+
+	QBENCHMARK {
+		for(auto i = 1; i <= ChangeCount; i++) {
+			viewModel.setValue(i);
+			// give the event loop a turn every 16 changes, like a frame would
+			if(i % 16 == 0)
+				QCoreApplication::processEvents();
+		}
+		viewModel.setValue(0);
+	}
+	QCOMPARE(views.last()->value(), 0);
+
+	for(auto &binding : bindings)
+		binding.unbind();
+	flushDeletions();
+}
+
+Binding BindingBenchmark::bindSpinBox(BenchBindingObject *viewModel, QSpinBox *view, Overload overload, Binding::BindingDirection type)
+{
+	switch(overload) {
+	case ByName:
+		return bind(viewModel, "value", view, "value", type);
+	case ByMetaProperty:
+	{
+		static const auto vmProperty = BenchBindingObject::staticMetaObject.property(BenchBindingObject::staticMetaObject.indexOfProperty("value"));
+		static const auto vProperty = QSpinBox::staticMetaObject.property(QSpinBox::staticMetaObject.indexOfProperty("value"));
+		return bind(viewModel, vmProperty, view, vProperty, type);
+	}
+	case SignalsByName:
+		return bind(viewModel, "value", view, "value", type, "valueUpdated()", "editingFinished()");
+	case SignalsByMetaMethod:
+	{
+		static const auto vmProperty = BenchBindingObject::staticMetaObject.property(BenchBindingObject::staticMetaObject.indexOfProperty("value"));
+		static const auto vProperty = QSpinBox::staticMetaObject.property(QSpinBox::staticMetaObject.indexOfProperty("value"));
+		static const auto vmSignal = QMetaMethod::fromSignal(&BenchBindingObject::valueUpdated);
+		static const auto vSignal = QMetaMethod::fromSignal(&QSpinBox::editingFinished);
+		return bind(viewModel, vmProperty, view, vProperty, type, vmSignal, vSignal);
+	}
+	default:
+		Q_UNREACHABLE();
+		return {};
+	}
+}
+
+void BindingBenchmark::createViews(QWidget *parent, QVector<QSpinBox *> &views, int count)
+{
+	views.reserve(count);
+	for(auto i = 0; i < count; i++) {
+		auto view = new QSpinBox{parent};
+		view->setRange(0, ChangeCount);
+		views.append(view);
+	}
+}
+
+void BindingBenchmark::flushDeletions()
+{
+	QCoreApplication::sendPostedEvents(nullptr, QEvent::DeferredDelete);
+}
+
+int main(int argc, char *argv[])
+{
+	// measure on a real raster backend without a display
+	qputenv("QT_QPA_PLATFORM", "offscreen");
+	QApplication app{argc, argv};
+	BindingBenchmark benchmark;
+	return QTest::qExec(&benchmark, argc, argv);
+}
+
+#include "tst_bench_binding.moc"
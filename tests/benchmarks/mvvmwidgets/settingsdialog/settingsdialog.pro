@@ -0,0 +1,15 @@
+TEMPLATE = app
+
+QT += testlib mvvmwidgets
+CONFIG += console
+CONFIG -= app_bundle
+
+TARGET = tst_bench_settingsdialog
+
+HEADERS += \
+	../../../shared/syntheticsettings.h
+
+SOURCES += \
+	tst_bench_settingsdialog.cpp
+
+include(../../../auto/testrun.pri)
@@ -0,0 +1,186 @@
+#include <QtTest>
+#include <QtWidgets>
+#include <QtMvvmCore/ServiceRegistry>
+#include <QtMvvmCore/SettingsViewModel>
+#include <QtMvvmWidgets/WidgetsPresenter>
+#include <QtMvvmWidgets/SettingsDialog>
+#include <QtMvvmWidgets/InputWidgetFactory>
+#include "../../../shared/syntheticsettings.h"
+using namespace QtMvvm;
+
+class SettingsDialogBenchmark : public QObject
+{
+	Q_OBJECT
+
+private Q_SLOTS:
+	void initTestCase();
+
+	void benchConstruction_data();
+	void benchConstruction();
+	void benchSearch_data();
+	void benchSearch();
+	void benchSelectionInput_data();
+	void benchSelectionInput();
+
+private:
+	QTemporaryDir tDir;
+	QSettings *settings = nullptr;
+	QHash<int, QString> documents;
+
+	void addSizeColumns();
+	// creates the dialog and lets it build the ui for the given document, like the presenter does
+	void createDialog(QScopedPointer<SettingsDialog> &dialog, SettingsViewModel *viewModel, int count);
+};
+
+void SettingsDialogBenchmark::initTestCase()
+{
+	QVERIFY(tDir.isValid());
+	WidgetsPresenter::registerAsPresenter<WidgetsPresenter>();
+	settings = new QSettings{tDir.filePath(QStringLiteral("settings.ini")), QSettings::IniFormat, this};
+	for(auto count : {100, 1000, 10000})
+		documents.insert(count, SyntheticSettings::generate(tDir.path(), count));
+}
+
+void SettingsDialogBenchmark::benchConstruction_data()
+{
+	addSizeColumns();
+}
+
+void SettingsDialogBenchmark::benchConstruction()
+{
+	QFETCH(int, count);
+
+	// the setup loader is shared and caches the setup, so this measures the ui creation only.
+	// Every run includes the destruction of the dialog from the previous one
+	QScopedPointer<SettingsDialog> dialog;
+	QScopedPointer<SettingsViewModel> viewModel;
+	QBENCHMARK {
+		dialog.reset();
+		viewModel.reset(new SettingsViewModel{});
+		createDialog(dialog, viewModel.data(), count);
+	}
+
+	auto categoryList = dialog->findChild<QListWidget*>(QStringLiteral("categoryListWidget"));
+	QVERIFY(categoryList);
+	QCOMPARE(categoryList->count(), SyntheticSettings::categoryCount(count));
+}
+
+void SettingsDialogBenchmark::benchSearch_data()
+{
+	QTest::addColumn<int>("count");
+	QTest::addColumn<QStringList>("patterns");
+
+	for(auto count : {100, 1000, 10000}) {
+		// typing a search term one character at a time
+		QTest::addRow("typing-%d", count) << count
+										  << QStringList {
+												 QStringLiteral("e"),
+												 QStringLiteral("en"),
+												 QStringLiteral("ent"),
+												 QStringLiteral("entr"),
+												 QStringLiteral("entry"),
+												 QStringLiteral("entry "),
+												 QStringLiteral("entry 4"),
+												 QStringLiteral("entry 42")
+											 };
+		QTest::addRow("searchkey-%d", count) << count
+											 << QStringList {
+													QStringLiteral("alias42"),
+													QString()
+												};
+		QTest::addRow("miss-%d", count) << count
+										<< QStringList {
+											   QStringLiteral("nothing matches this"),
+											   QString()
+										   };
+	}
+}
+
+void SettingsDialogBenchmark::benchSearch()
+{
+	QFETCH(int, count);
+	QFETCH(QStringList, patterns);
+
+	QScopedPointer<SettingsViewModel> viewModel{new SettingsViewModel{}};
+	QScopedPointer<SettingsDialog> dialog;
+	createDialog(dialog, viewModel.data(), count);
+	dialog->show();
+	QVERIFY(QTest::qWaitForWindowExposed(dialog.data()));
+
+	auto filterEdit = dialog->findChild<QLineEdit*>(QStringLiteral("filterLineEdit"));
+	QVERIFY(filterEdit);
+	QBENCHMARK {
+		for(const auto &pattern : qAsConst(patterns))
+			filterEdit->setText(pattern);
+		filterEdit->clear();
+	}
+}
+
+void SettingsDialogBenchmark::benchSelectionInput_data()
+{
+	QTest::addColumn<int>("count");
+	QTest::addColumn<bool>("filterPopup");
+
+	for(auto count : {100, 1000, 10000, 100000}) {
+		QTest::addRow("plain-%d", count) << count << false;
+		QTest::addRow("filtered-%d", count) << count << true;
+	}
+}
+
+void SettingsDialogBenchmark::benchSelectionInput()
+{
+	QFETCH(int, count);
+	QFETCH(bool, filterPopup);
+
+	QVariantList elements;
+	elements.reserve(count);
+	for(auto i = 0; i < count; i++) {
+		elements.append(QVariantMap {
+							{QStringLiteral("name"), QStringLiteral("Option %1").arg(i)},
+							{QStringLiteral("value"), i}
+						});
+	}
+	const QVariantMap properties {
+		{QStringLiteral("listElements"), elements},
+		{QStringLiteral("filterPopup"), filterPopup}
+	};
+
+	// like the settings dialog, which creates an input for every entry that uses the same elements
+	auto factory = WidgetsPresenter::getInputWidgetFactory();
+	QWidget parent;
+	QBENCHMARK {
+		for(auto i = 0; i < 10; i++) {
+			auto widget = factory->createInput("selection", &parent, properties);
+			widget->setProperty("currentValue", count - 1);
+		}
+		qDeleteAll(parent.findChildren<QWidget*>(QString{}, Qt::FindDirectChildrenOnly));
+	}
+}
+
+void SettingsDialogBenchmark::addSizeColumns()
+{
+	QTest::addColumn<int>("count");
+
+	QTest::newRow("100") << 100;
+	QTest::newRow("1000") << 1000;
+	QTest::newRow("10000") << 10000;
+}
+
+void SettingsDialogBenchmark::createDialog(QScopedPointer<SettingsDialog> &dialog, SettingsViewModel *viewModel, int count)
+{
+	viewModel->setSettingsSetupLoader(ServiceRegistry::instance()->service<ISettingsSetupLoader>());
+	dialog.reset(new SettingsDialog{viewModel});
+	static_cast<ViewModel*>(viewModel)->onInit(SettingsViewModel::showParams(settings, documents.value(count)));
+}
+
+int main(int argc, char *argv[])
+{
+	// measure on a real raster backend without a display and with all parts of the documents active
+	qputenv("QT_QPA_PLATFORM", "offscreen");
+	qputenv("QT_FILE_SELECTORS", SyntheticSettings::selector().toUtf8());
+	QApplication app{argc, argv};
+	SettingsDialogBenchmark benchmark;
+	return QTest::qExec(&benchmark, argc, argv);
+}
+
+#include "tst_bench_settingsdialog.moc"
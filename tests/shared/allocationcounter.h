@@ -0,0 +1,102 @@
+#ifndef ALLOCATIONCOUNTER_H
+#define ALLOCATIONCOUNTER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdlib>
+#include <new>
+
+// Replaces the global operator new and delete to track the number of bytes currently allocated
+// through them. As the replacement functions are defined here, this header must only be included
+// by a single source file of a benchmark. Allocations of other libraries are only counted on
+// platforms that resolve the operators globally, i.e. not for DLLs on Windows.
+namespace AllocationCounter {
+
+// stored in front of every block, keeps the returned pointers aligned
+const std::size_t HeaderSize = alignof(std::max_align_t) > sizeof(std::size_t) ?
+								   alignof(std::max_align_t) :
+								   sizeof(std::size_t);
+
+inline std::atomic<long long> &liveBytes() {
+	static std::atomic<long long> bytes{0};
+	return bytes;
+}
+
+// the number of bytes currently allocated via operator new
+inline long long current() {
+	return liveBytes().load(std::memory_order_relaxed);
+}
+
+inline void *allocate(std::size_t size) noexcept {
+	auto block = static_cast<char*>(std::malloc(size + HeaderSize));
+	if(!block)
+		return nullptr;
+	*reinterpret_cast<std::size_t*>(block) = size;
+	liveBytes().fetch_add(static_cast<long long>(size), std::memory_order_relaxed);
+	return block + HeaderSize;
+}
+
+inline void release(void *ptr) noexcept {
+	if(!ptr)
+		return;
+	auto block = static_cast<char*>(ptr) - HeaderSize;
+	liveBytes().fetch_sub(static_cast<long long>(*reinterpret_cast<std::size_t*>(block)), std::memory_order_relaxed);
+	std::free(block);
+}
+
+}
+
+void *operator new(std::size_t size)
+{
+	auto ptr = AllocationCounter::allocate(size);
+	if(!ptr)
+		throw std::bad_alloc{};
+	return ptr;
+}
+
+void *operator new[](std::size_t size)
+{
+	return operator new(size);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept
+{
+	return AllocationCounter::allocate(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept
+{
+	return AllocationCounter::allocate(size);
+}
+
+void operator delete(void *ptr) noexcept
+{
+	AllocationCounter::release(ptr);
+}
+
+void operator delete[](void *ptr) noexcept
+{
+	AllocationCounter::release(ptr);
+}
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+	AllocationCounter::release(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t) noexcept
+{
+	AllocationCounter::release(ptr);
+}
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept
+{
+	AllocationCounter::release(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept
+{
+	AllocationCounter::release(ptr);
+}
+
+#endif // ALLOCATIONCOUNTER_H
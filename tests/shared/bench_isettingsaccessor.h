@@ -0,0 +1,296 @@
+#ifndef BENCH_ISETTINGSACCESSOR_H
+#define BENCH_ISETTINGSACCESSOR_H
+
+#include <QtCore/QObject>
+#include <QtCore/QRandomGenerator>
+#include <QtCore/QElapsedTimer>
+#include <QtMvvmCore/ISettingsAccessor>
+#include <QtMvvmCore/SettingsEntry>
+#include <QtTest>
+
+#include <algorithm>
+
+// The counterpart of ISettingsAccessorTest for benchmarks. Every accessor benchmark runs the
+// same workloads with the same data row names and a fixed random seed, so results can be
+// compared across backends and releases.
+class ISettingsAccessorBenchmark : public QObject
+{
+	Q_OBJECT
+
+protected:
+	// creates a new, empty accessor. Called once per benchmark function
+	virtual QtMvvm::ISettingsAccessor *createAccessor() = 0;
+	// releases the accessor again. The default deletes it
+	virtual void destroyAccessor(QtMvvm::ISettingsAccessor *accessor) {
+		delete accessor;
+	}
+
+private:
+	struct ListElement {
+		QtMvvm::SettingsEntry<int> value;
+		QtMvvm::SettingsEntry<QString> name;
+	};
+
+	QtMvvm::ISettingsAccessor *accessor = nullptr;
+
+	static QStringList createKeys(int count, bool random) {
+		QStringList keys;
+		keys.reserve(count);
+		for(auto i = 0; i < count; i++)
+			keys.append(QStringLiteral("bench/group%1/key%2").arg(i / 100).arg(i));
+		if(random) {
+			QRandomGenerator rng{42};
+			std::shuffle(keys.begin(), keys.end(), rng);
+		}
+		return keys;
+	}
+
+	void addAccessColumns() {
+		QTest::addColumn<int>("count");
+		QTest::addColumn<bool>("random");
+
+		for(auto count : {100, 1000, 10000}) {
+			QTest::addRow("sequential-%d", count) << count << false;
+			QTest::addRow("random-%d", count) << count << true;
+		}
+	}
+
+	void populate(const QStringList &keys) {
+		auto value = 0;
+		for(const auto &key : keys)
+			accessor->save(key, value++);
+	}
+
+	// waits until all (possibly asynchronous) change signals have been delivered
+	bool waitFor(const int &received, int expected) {
+		QElapsedTimer timer;
+		timer.start();
+		while(received < expected) {
+			if(timer.hasExpired(10000))
+				return false;
+			QCoreApplication::processEvents(QEventLoop::AllEvents, 10);
+		}
+		return true;
+	}
+
+private Q_SLOTS:
+	void init() {
+		accessor = createAccessor();
+		QVERIFY(accessor);
+	}
+
+	void cleanup() {
+		destroyAccessor(accessor);
+		accessor = nullptr;
+	}
+
+	void benchLoad_data() {
+		addAccessColumns();
+	}
+
+	void benchLoad() {
+		QFETCH(int, count);
+		QFETCH(bool, random);
+
+		populate(createKeys(count, false));
+		const auto keys = createKeys(count, random);
+		// reset for every pass, so repeated passes cannot overflow it
+		qint64 sum = 0;
+		QBENCHMARK {
+			sum = 0;
+			for(const auto &key : keys)
+				sum += accessor->load(key).toInt();
+		}
+		QVERIFY(sum >= 0);
+	}
+
+	void benchSave_data() {
+		addAccessColumns();
+	}
+
+	void benchSave() {
+		QFETCH(int, count);
+		QFETCH(bool, random);
+
+		const auto keys = createKeys(count, random);
+		auto value = 0;
+		QBENCHMARK {
+			for(const auto &key : keys)
+				accessor->save(key, value++);
+		}
+		QCOMPARE(accessor->load(keys.last()).toInt(), value - 1);
+	}
+
+	void benchLoadTyped_data() {
+		addAccessColumns();
+	}
+
+	// same as benchLoad, but via the typed path used by SettingsEntry<int>
+	void benchLoadTyped() {
+		QFETCH(int, count);
+		QFETCH(bool, random);
+
+		populate(createKeys(count, false));
+		const auto keys = createKeys(count, random);
+		// reset for every pass, so repeated passes cannot overflow it
+		qint64 sum = 0;
+		QBENCHMARK {
+			sum = 0;
+			for(const auto &key : keys)
+				sum += accessor->loadInt(key);
+		}
+		QVERIFY(sum >= 0);
+	}
+
+	void benchSaveTyped_data() {
+		addAccessColumns();
+	}
+
+	void benchSaveTyped() {
+		QFETCH(int, count);
+		QFETCH(bool, random);
+
+		const auto keys = createKeys(count, random);
+		auto value = 0;
+		QBENCHMARK {
+			for(const auto &key : keys)
+				accessor->saveInt(key, value++);
+		}
+		QCOMPARE(accessor->loadInt(keys.last()), value - 1);
+	}
+
+	void benchContains_data() {
+		QTest::addColumn<int>("count");
+		QTest::addColumn<bool>("hit");
+
+		for(auto count : {100, 1000, 10000}) {
+			QTest::addRow("hit-%d", count) << count << true;
+			QTest::addRow("miss-%d", count) << count << false;
+		}
+	}
+
+	void benchContains() {
+		QFETCH(int, count);
+		QFETCH(bool, hit);
+
+		auto keys = createKeys(count, true);
+		populate(keys);
+		if(!hit) {
+			for(auto &key : keys)
+				key.append(QStringLiteral("/missing"));
+		}
+		auto found = 0;
+		QBENCHMARK {
+			found = 0;
+			for(const auto &key : qAsConst(keys)) {
+				if(accessor->contains(key))
+					found++;
+			}
+		}
+		QCOMPARE(found, hit ? count : 0);
+	}
+
+	void benchRemoveTree_data() {
+		QTest::addColumn<int>("depth");
+		QTest::addColumn<int>("breadth");
+
+		QTest::newRow("flat-1000") << 1 << 1000;
+		QTest::newRow("deep-10x2") << 10 << 2;
+		QTest::newRow("wide-3x10") << 3 << 10;
+		QTest::newRow("wide-4x10") << 4 << 10;
+	}
+
+	void benchRemoveTree() {
+		QFETCH(int, depth);
+		QFETCH(int, breadth);
+
+		// creates all keys of a full tree, each node is a value as well
+		QStringList keys;
+		QStringList level {QStringLiteral("tree")};
+		for(auto d = 0; d < depth; d++) {
+			QStringList nextLevel;
+			for(const auto &parent : qAsConst(level)) {
+				for(auto b = 0; b < breadth; b++)
+					nextLevel.append(parent + QStringLiteral("/n%1").arg(b));
+			}
+			keys.append(nextLevel);
+			level = std::move(nextLevel);
+		}
+
+		// only one iteration, as the tree has to be recreated for every run
+		populate(keys);
+		QBENCHMARK_ONCE {
+			accessor->remove(QStringLiteral("tree"));
+		}
+		QVERIFY(!accessor->contains(keys.last()));
+	}
+
+	void benchChangeSignals_data() {
+		QTest::addColumn<int>("subscribers");
+
+		QTest::newRow("1") << 1;
+		QTest::newRow("10") << 10;
+		QTest::newRow("100") << 100;
+	}
+
+	void benchChangeSignals() {
+		QFETCH(int, subscribers);
+
+		const auto keys = createKeys(100, false);
+		QScopedPointer<QObject> scope{new QObject{}};
+		auto received = 0;
+		for(auto i = 0; i < subscribers; i++) {
+			connect(accessor, &QtMvvm::ISettingsAccessor::entryChanged,
+					scope.data(), [&received](const QString &, const QVariant &) {
+				received++;
+			});
+		}
+
+		auto value = 0;
+		QBENCHMARK {
+			received = 0;
+			for(const auto &key : keys)
+				accessor->save(key, value++);
+			QVERIFY(waitFor(received, keys.size() * subscribers));
+		}
+	}
+
+	void benchListNodeIteration_data() {
+		QTest::addColumn<int>("count");
+
+		QTest::newRow("100") << 100;
+		QTest::newRow("1000") << 1000;
+	}
+
+	void benchListNodeIteration() {
+		QFETCH(int, count);
+
+		auto setupFn = [this](int index, ListElement &element) {
+			const auto key = QStringLiteral("list/%1").arg(index);
+			element.value.setup(key + QStringLiteral("/value"), accessor);
+			element.name.setup(key + QStringLiteral("/name"), accessor);
+		};
+		{
+			QtMvvm::SettingsListNode<ListElement> node;
+			node.setup(QStringLiteral("list"), accessor, setupFn);
+			for(auto i = 0; i < count; i++) {
+				auto &element = node.push();
+				element.value = i;
+				element.name = QStringLiteral("element%1").arg(i);
+			}
+		}
+
+		auto sum = 0;
+		QBENCHMARK {
+			// a fresh node each run, like a freshly created settings instance
+			QtMvvm::SettingsListNode<ListElement> node;
+			node.setup(QStringLiteral("list"), accessor, setupFn);
+			sum = 0;
+			for(const auto &element : qAsConst(node))
+				sum += element.value.get() + element.name.get().size();
+		}
+		QVERIFY(sum > 0);
+	}
+};
+
+#endif // BENCH_ISETTINGSACCESSOR_H
@@ -0,0 +1,56 @@
+#ifndef BENCHBINDINGOBJECT_H
+#define BENCHBINDINGOBJECT_H
+
+#include <QtCore/QObject>
+#include <QtCore/QString>
+
+// A minimal object with notifying properties, used as viewmodel and as plain view by the binding
+// benchmarks. The setters only emit if the value actually changed, like generated properties do.
+class BenchBindingObject : public QObject
+{
+	Q_OBJECT
+
+	Q_PROPERTY(int value READ value WRITE setValue NOTIFY valueChanged)
+	Q_PROPERTY(QString text READ text WRITE setText NOTIFY textChanged)
+
+public:
+	explicit BenchBindingObject(QObject *parent = nullptr) :
+		QObject{parent}
+	{}
+
+	int value() const {
+		return _value;
+	}
+
+	QString text() const {
+		return _text;
+	}
+
+public Q_SLOTS:
+	void setValue(int value) {
+		if(_value == value)
+			return;
+		_value = value;
+		emit valueChanged(_value);
+		emit valueUpdated();
+	}
+
+	void setText(const QString &text) {
+		if(_text == text)
+			return;
+		_text = text;
+		emit textChanged(_text);
+	}
+
+Q_SIGNALS:
+	void valueChanged(int value);
+	void textChanged(const QString &text);
+	// an alternative change signal, to bind with explicit signals
+	void valueUpdated();
+
+private:
+	int _value = 0;
+	QString _text;
+};
+
+#endif // BENCHBINDINGOBJECT_H
@@ -0,0 +1,185 @@
+#ifndef FAKEDATASYNCBACKEND_H
+#define FAKEDATASYNCBACKEND_H
+
+#include <QtCore/QObject>
+#include <QtCore/QRandomGenerator>
+#include <QtCore/QUuid>
+
+#include <QtDataSync/SyncManager>
+#include <QtDataSync/AccountManager>
+#include <QtDataSync/UserExchangeManager>
+
+#include <QtMvvmDataSyncCore/AccountModel>
+#include <QtMvvmDataSyncCore/ExchangeDevicesModel>
+
+// In-process stand-ins for the QtDataSync managers. They expose the same signals as the real
+// managers and feed them directly into the datasync models, so no setup, engine or remote
+// is required. The classes are deterministic for a given seed.
+
+class FakeSyncManager : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit FakeSyncManager(QObject *parent = nullptr) :
+		QObject{parent}
+	{}
+
+	QtDataSync::SyncManager::SyncState syncState() const {
+		return _state;
+	}
+
+	void setSyncState(QtDataSync::SyncManager::SyncState state) {
+		if(_state == state)
+			return;
+		_state = state;
+		emit syncStateChanged(_state);
+	}
+
+	// cycles through a full reconnect, i.e. disconnected -> initializing -> downloading -> synchronized
+	void reconnectCycle() {
+		setSyncState(QtDataSync::SyncManager::Disconnected);
+		setSyncState(QtDataSync::SyncManager::Initializing);
+		setSyncState(QtDataSync::SyncManager::Downloading);
+		setSyncState(QtDataSync::SyncManager::Synchronized);
+	}
+
+	// cycles through a sync that does not drop the connection
+	void syncCycle() {
+		setSyncState(QtDataSync::SyncManager::Uploading);
+		setSyncState(QtDataSync::SyncManager::Downloading);
+		setSyncState(QtDataSync::SyncManager::Synchronized);
+	}
+
+	void attach(QtMvvm::AccountModel *model) {
+		connect(this, SIGNAL(syncStateChanged(QtDataSync::SyncManager::SyncState)),
+				model, SLOT(update(QtDataSync::SyncManager::SyncState)));
+	}
+
+Q_SIGNALS:
+	void syncStateChanged(QtDataSync::SyncManager::SyncState syncState);
+	void lastErrorChanged(const QString &lastError);
+
+private:
+	QtDataSync::SyncManager::SyncState _state = QtDataSync::SyncManager::Synchronized;
+};
+
+class FakeAccountManager : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit FakeAccountManager(quint32 seed = 42, QObject *parent = nullptr) :
+		QObject{parent},
+		_rng{seed}
+	{}
+
+	QList<QtDataSync::DeviceInfo> devices() const {
+		return _devices;
+	}
+
+	// replaces the device list with count generated devices. Does not publish them
+	void generateDevices(int count) {
+		_devices.clear();
+		_devices.reserve(count);
+		for(auto i = 0; i < count; i++)
+			_devices.append(createDevice());
+	}
+
+	// applies count random renames, removals and additions to the device list. Does not publish them
+	void churnDevices(int count) {
+		for(auto i = 0; i < count; i++) {
+			switch(_devices.isEmpty() ? 2 : _rng.bounded(3)) {
+			case 0: {
+				auto &device = _devices[_rng.bounded(_devices.size())];
+				device.setName(randomName());
+				break;
+			}
+			case 1:
+				_devices.removeAt(_rng.bounded(_devices.size()));
+				break;
+			case 2:
+				_devices.insert(_rng.bounded(_devices.size() + 1), createDevice());
+				break;
+			default:
+				Q_UNREACHABLE();
+				break;
+			}
+		}
+	}
+
+	// publishes the current device list, like AccountManager::listDevices does
+	void listDevices() {
+		emit accountDevices(_devices);
+	}
+
+	void attach(QtMvvm::AccountModel *model) {
+		connect(this, SIGNAL(accountDevices(QList<QtDataSync::DeviceInfo>)),
+				model, SLOT(accountDevices(QList<QtDataSync::DeviceInfo>)));
+	}
+
+Q_SIGNALS:
+	void accountDevices(const QList<QtDataSync::DeviceInfo> &devices);
+	void deviceNameChanged(const QString &deviceName);
+	void importAccepted();
+	void accountAccessGranted(const QUuid &deviceId);
+
+private:
+	QRandomGenerator _rng;
+	QList<QtDataSync::DeviceInfo> _devices;
+
+	QString randomName() {
+		return QStringLiteral("device-%1").arg(_rng.generate(), 8, 16, QLatin1Char('0'));
+	}
+
+	QtDataSync::DeviceInfo createDevice() {
+		QByteArray fingerprint{32, Qt::Uninitialized};
+		for(auto &c : fingerprint)
+			c = static_cast<char>(_rng.bounded(256));
+		return {
+			QUuid::createUuid(),
+			randomName(),
+			fingerprint
+		};
+	}
+};
+
+// UserInfo can be default constructed, but only the real UserExchangeManager can fill in a name
+// and address, so this stand-in replays lists of infos that were passed to it instead of generating them
+class FakeUserExchangeManager : public QObject
+{
+	Q_OBJECT
+
+public:
+	explicit FakeUserExchangeManager(QObject *parent = nullptr) :
+		QObject{parent}
+	{}
+
+	QList<QtDataSync::UserInfo> devices() const {
+		return _devices;
+	}
+
+	void setDevices(QList<QtDataSync::UserInfo> devices) {
+		_devices = std::move(devices);
+	}
+
+	// publishes the current device list, like the periodic datagram of UserExchangeManager
+	void announce() {
+		emit devicesChanged(_devices);
+	}
+
+	void attach(QtMvvm::ExchangeDevicesModel *model) {
+		connect(this, SIGNAL(devicesChanged(QList<QtDataSync::UserInfo>)),
+				model, SLOT(updateDevices(QList<QtDataSync::UserInfo>)));
+	}
+
+Q_SIGNALS:
+	void devicesChanged(const QList<QtDataSync::UserInfo> &devices);
+	void userDataReceived(const QtDataSync::UserInfo &userInfo, bool trusted);
+	void exchangeError(const QString &errorString);
+
+private:
+	QList<QtDataSync::UserInfo> _devices;
+};
+
+#endif // FAKEDATASYNCBACKEND_H
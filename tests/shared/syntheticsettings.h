@@ -0,0 +1,178 @@
+#ifndef SYNTHETICSETTINGS_H
+#define SYNTHETICSETTINGS_H
+
+#include <QtCore/QDir>
+#include <QtCore/QFile>
+#include <QtCore/QXmlStreamWriter>
+
+// Generates settings.xml documents of arbitrary size for the settings benchmarks. Every group,
+// section and category lives in its own file, so the root document is the top of an include tree
+// that is three levels deep. Parts of the tree are filtered by frontends and selectors, and every
+// fourth group is replaced by a file selected variant. The generated setup contains exactly count
+// visible entries for the "widgets" and "quick" frontends when SyntheticSettings::selector() is active.
+class SyntheticSettings
+{
+public:
+	static const int EntriesPerGroup = 10;
+	static const int GroupsPerSection = 5;
+	static const int SectionsPerCategory = 4;
+
+	// the extra file selector that activates all selector dependent parts of the documents
+	static QString selector() {
+		return QStringLiteral("bench");
+	}
+
+	static int categoryCount(int count) {
+		return (sectionCount(count) + SectionsPerCategory - 1) / SectionsPerCategory;
+	}
+
+	static int sectionCount(int count) {
+		const auto groups = (count + EntriesPerGroup - 1) / EntriesPerGroup;
+		return (groups + GroupsPerSection - 1) / GroupsPerSection;
+	}
+
+	// writes the documents for count entries into dir and returns the path of the root document
+	static QString generate(const QDir &dir, int count) {
+		dir.mkpath(QStringLiteral("+%1").arg(selector()));
+		const auto prefix = QStringLiteral("s%1_").arg(count);
+
+		auto entry = 0;
+		QStringList categoryFiles;
+		for(auto c = 0; entry < count; c++) {
+			QStringList sectionFiles;
+			for(auto s = 0; s < SectionsPerCategory && entry < count; s++) {
+				QStringList groupFiles;
+				for(auto g = 0; g < GroupsPerSection && entry < count; g++) {
+					const auto fileName = prefix + QStringLiteral("group_%1_%2_%3.xml").arg(c).arg(s).arg(g);
+					const auto first = entry;
+					entry = qMin(entry + EntriesPerGroup, count);
+					writeGroup(dir.absoluteFilePath(fileName), g, first, entry, false);
+					if(g % 4 == 0) {
+						writeGroup(dir.absoluteFilePath(QStringLiteral("+%1/").arg(selector()) + fileName),
+								   g, first, entry, true);
+					}
+					// absolute, as file selectors are applied before relative includes are resolved
+					groupFiles.append(dir.absoluteFilePath(fileName));
+				}
+
+				const auto fileName = prefix + QStringLiteral("section_%1_%2.xml").arg(c).arg(s);
+				writeDocument(dir.absoluteFilePath(fileName), [&](QXmlStreamWriter &writer) {
+					writer.writeStartElement(QStringLiteral("Section"));
+					writer.writeAttribute(QStringLiteral("title"), QStringLiteral("Section %1.%2").arg(c).arg(s));
+					writer.writeAttribute(QStringLiteral("icon"), QStringLiteral("qrc:/bench/section.svg"));
+					for(const auto &groupFile : qAsConst(groupFiles))
+						writer.writeTextElement(QStringLiteral("Include"), groupFile);
+					writer.writeEndElement();
+				});
+				sectionFiles.append(fileName);
+			}
+
+			const auto fileName = prefix + QStringLiteral("category_%1.xml").arg(c);
+			writeDocument(dir.absoluteFilePath(fileName), [&](QXmlStreamWriter &writer) {
+				writer.writeStartElement(QStringLiteral("Category"));
+				writer.writeAttribute(QStringLiteral("title"), QStringLiteral("Category %1").arg(c));
+				writer.writeAttribute(QStringLiteral("tooltip"), QStringLiteral("The settings category number %1").arg(c));
+				for(const auto &sectionFile : qAsConst(sectionFiles))
+					writer.writeTextElement(QStringLiteral("Include"), sectionFile);
+				// a section only the console would see
+				writer.writeStartElement(QStringLiteral("Include"));
+				writer.writeAttribute(QStringLiteral("frontends"), QStringLiteral("console"));
+				writer.writeCharacters(sectionFiles.first());
+				writer.writeEndElement();
+				writer.writeEndElement();
+			});
+			categoryFiles.append(fileName);
+		}
+
+		const auto rootFile = dir.absoluteFilePath(prefix + QStringLiteral("settings.xml"));
+		writeDocument(rootFile, [&](QXmlStreamWriter &writer) {
+			writer.writeStartElement(QStringLiteral("SettingsConfig"));
+			writer.writeAttribute(QStringLiteral("allowSearch"), QStringLiteral("true"));
+			writer.writeAttribute(QStringLiteral("allowRestore"), QStringLiteral("true"));
+			for(const auto &categoryFile : qAsConst(categoryFiles))
+				writer.writeTextElement(QStringLiteral("Include"), categoryFile);
+			writer.writeEndElement();
+		});
+		return rootFile;
+	}
+
+private:
+	template <typename TFn>
+	static void writeDocument(const QString &path, const TFn &fn) {
+		QFile file{path};
+		if(!file.open(QIODevice::WriteOnly | QIODevice::Truncate))
+			qFatal("Failed to write %s: %s", qUtf8Printable(path), qUtf8Printable(file.errorString()));
+		QXmlStreamWriter writer{&file};
+		writer.setAutoFormatting(true);
+		writer.setAutoFormattingIndent(-1);
+		writer.writeStartDocument();
+		fn(writer);
+		writer.writeEndDocument();
+	}
+
+	static void writeGroup(const QString &path, int index, int firstEntry, int endEntry, bool selected) {
+		static const QStringList types {
+			QStringLiteral("bool"),
+			QStringLiteral("int"),
+			QStringLiteral("QString"),
+			QStringLiteral("double"),
+			QStringLiteral("url"),
+			QStringLiteral("selection")
+		};
+
+		writeDocument(path, [&](QXmlStreamWriter &writer) {
+			writer.writeStartElement(QStringLiteral("Group"));
+			// the first group of every section stays unnamed
+			if(index != 0) {
+				writer.writeAttribute(QStringLiteral("title"), selected ?
+										  QStringLiteral("Selected group %1").arg(index) :
+										  QStringLiteral("Group %1").arg(index));
+			}
+			for(auto i = firstEntry; i < endEntry; i++) {
+				writer.writeStartElement(QStringLiteral("Entry"));
+				writer.writeAttribute(QStringLiteral("key"), QStringLiteral("bench/entry%1").arg(i));
+				writer.writeAttribute(QStringLiteral("type"), types[i % types.size()]);
+				writer.writeAttribute(QStringLiteral("title"), i % 3 == 0 ?
+										  QStringLiteral("&Entry %1").arg(i) :
+										  QStringLiteral("Entry %1").arg(i));
+				writer.writeAttribute(QStringLiteral("tooltip"), QStringLiteral("Tooltip of entry %1").arg(i));
+				writer.writeAttribute(QStringLiteral("default"), QString::number(i));
+				if(i % 5 == 0)
+					writer.writeAttribute(QStringLiteral("frontends"), QStringLiteral("widgets|quick"));
+				if(i % 7 == 0)
+					writer.writeAttribute(QStringLiteral("selectors"), selector() + QStringLiteral("|other"));
+				writer.writeTextElement(QStringLiteral("SearchKey"), QStringLiteral("key%1").arg(i));
+				writer.writeTextElement(QStringLiteral("SearchKey"), QStringLiteral("alias%1").arg(i % 100));
+				if(types[i % types.size()] == QStringLiteral("selection")) {
+					writer.writeStartElement(QStringLiteral("Property"));
+					writer.writeAttribute(QStringLiteral("key"), QStringLiteral("listElements"));
+					writer.writeAttribute(QStringLiteral("type"), QStringLiteral("list"));
+					for(auto e = 0; e < 3; e++) {
+						writer.writeStartElement(QStringLiteral("Element"));
+						writer.writeAttribute(QStringLiteral("type"), QStringLiteral("string"));
+						writer.writeCharacters(QStringLiteral("Option %1").arg(e));
+						writer.writeEndElement();
+					}
+					writer.writeEndElement();
+				}
+				writer.writeEndElement();
+			}
+
+			// entries that are filtered out by the frontend or the selectors
+			writer.writeStartElement(QStringLiteral("Entry"));
+			writer.writeAttribute(QStringLiteral("key"), QStringLiteral("bench/console%1").arg(firstEntry));
+			writer.writeAttribute(QStringLiteral("type"), QStringLiteral("bool"));
+			writer.writeAttribute(QStringLiteral("frontends"), QStringLiteral("console"));
+			writer.writeEndElement();
+			writer.writeStartElement(QStringLiteral("Entry"));
+			writer.writeAttribute(QStringLiteral("key"), QStringLiteral("bench/hidden%1").arg(firstEntry));
+			writer.writeAttribute(QStringLiteral("type"), QStringLiteral("bool"));
+			writer.writeAttribute(QStringLiteral("selectors"), selector() + QStringLiteral("&other"));
+			writer.writeEndElement();
+
+			writer.writeEndElement();
+		});
+	}
+};
+
+#endif // SYNTHETICSETTINGS_H
@@ -54,6 +54,51 @@ private Q_SLOTS:
 		QVERIFY(changedSpy.isEmpty());
 	}
 
+	void testTypedOperations() {
+		QSignalSpy changedSpy{first, &QtMvvm::ISettingsAccessor::entryChanged};
+
+		auto boolKey = QStringLiteral("typed/bool");
+		auto intKey = QStringLiteral("typed/int");
+		auto int64Key = QStringLiteral("typed/int64");
+		auto doubleKey = QStringLiteral("typed/double");
+		auto stringKey = QStringLiteral("typed/string");
+		auto bytesKey = QStringLiteral("typed/bytes");
+
+		QCOMPARE(first->loadBool(boolKey, true), true);
+		QCOMPARE(first->loadInt(intKey, 24), 24);
+		QCOMPARE(first->loadInt64(int64Key, 24), 24ll);
+		QCOMPARE(first->loadDouble(doubleKey, 2.4), 2.4);
+		QCOMPARE(first->loadString(stringKey, QStringLiteral("24")), QStringLiteral("24"));
+		QCOMPARE(first->loadByteArray(bytesKey, "24"), QByteArray{"24"});
+
+		first->saveBool(boolKey, false);
+		first->saveInt(intKey, 42);
+		first->saveInt64(int64Key, Q_INT64_C(4200000000));
+		first->saveDouble(doubleKey, 4.2);
+		first->saveString(stringKey, QStringLiteral("42"));
+		first->saveByteArray(bytesKey, "42");
+		QCOMPARE(first->loadBool(boolKey, true), false);
+		QCOMPARE(first->loadInt(intKey, 24), 42);
+		QCOMPARE(first->loadInt64(int64Key, 24), Q_INT64_C(4200000000));
+		QCOMPARE(first->loadDouble(doubleKey, 2.4), 4.2);
+		QCOMPARE(first->loadString(stringKey), QStringLiteral("42"));
+		QCOMPARE(first->loadByteArray(bytesKey), QByteArray{"42"});
+
+		// typed and variant access must be interchangeable
+		QCOMPARE(first->load(intKey).toInt(), 42);
+		first->save(intKey, 13);
+		QCOMPARE(first->loadInt(intKey), 13);
+
+		while(changedSpy.size() < 7)
+			QVERIFY(changedSpy.wait());
+		QCOMPARE(changedSpy.size(), 7);
+		QCOMPARE(changedSpy[1][0].toString(), intKey);
+		QCOMPARE(changedSpy[1][1].toInt(), 42);
+
+		first->remove(QStringLiteral("typed"));
+		QCOMPARE(first->loadInt(intKey, 24), 24);
+	}
+
 	void testBatchRemove() {
 		auto key0 = QStringLiteral("group");
 		auto key1 = QStringLiteral("group/key");
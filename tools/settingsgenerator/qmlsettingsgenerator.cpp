@@ -1,5 +1,6 @@
 #include "qmlsettingsgenerator.h"
 #include <QFileInfo>
+#include <algorithm>
 
 QmlSettingsGenerator::QmlSettingsGenerator(const QString &hdrPath, const QString &srcPath) :
 	_hdrFile{hdrPath},
@@ -48,6 +49,8 @@ int QmlSettingsGenerator::writeHeader(const SettingsType &settings, const QStrin
 	auto includes = QList<IncludeType> {
 		{false, QStringLiteral("QtCore/QObject")},
 		{false, QStringLiteral("QtCore/QScopedPointer")},
+		{false, QStringLiteral("QtCore/QAbstractListModel")},
+		{false, QStringLiteral("QtCore/QVector")},
 		{false, QStringLiteral("QtQml/QQmlListProperty")},
 		{false, hdrPath}
 	} + settings.includes;
@@ -206,6 +209,7 @@ int QmlSettingsGenerator::writeNodeClass(const NodeType &node, QStringList keyLi
 
 int QmlSettingsGenerator::writeListNodeClass(const ListNodeType &node, QStringList keyList, int offset, int listDepth)
 {
+	const auto parentKeyList = keyList;
 	keyList.append({node.key, QStringLiteral("at(_indexMap.at(%1))").arg(listDepth++)});
 	QList<int> childOffsets;
 	std::tie(offset, childOffsets) = writeNodeContentClasses(node, keyList, offset, listDepth);
@@ -232,9 +236,168 @@ int QmlSettingsGenerator::writeListNodeClass(const ListNodeType &node, QStringLi
 	_hdr << "\t}\n"
 		 << "};\n\n";
 
+	if(node.qmlModel)
+		writeListModelClass(node, parentKeyList, offset);
+
 	return ++offset;
 }
 
+void QmlSettingsGenerator::writeListModelClass(const ListNodeType &node, const QStringList &keyList, int classIndex)
+{
+	_listModels.insert(classIndex);
+	const auto nodeExpr = QStringLiteral("_settings->") + (QStringList{keyList} << node.key).join(QLatin1Char('.'));
+	QList<const EntryType*> roles;
+	collectModelRoles(node, roles);
+
+	// one row per list element. The element objects are only created once a row is accessed
+	_hdr << "class " << _name << "_ListModel_" << classIndex << " : public QAbstractListModel // " << (QStringList{keyList} << node.key).join(QLatin1Char('/')) << "\n"
+		 << "{\n"
+		 << "\tQ_OBJECT\n\n"
+		 << "\tusing SelfType = " << _name << "_ListModel_" << classIndex << ";\n"
+		 << "\tusing ElementType = " << _name << "_" << classIndex << ";\n"
+		 << "\t" << _cppName << " *_settings;\n"
+		 << "\tQList<int> _indexMap;\n"
+		 << "\tint _size = 0;\n"
+		 << "\tmutable QVector<ElementType*> _elements;\n\n"
+
+		 << "public:\n"
+		 << "\t" << _name << "_ListModel_" << classIndex << "(" << _cppName << " *settings, const QList<int> &indexMap, QObject *parent) : \n"
+		 << "\t\tQAbstractListModel{parent}\n"
+		 << "\t\t,_settings{settings}\n"
+		 << "\t\t,_indexMap{indexMap}\n"
+		 << "\t{\n"
+		 << "\t\t" << nodeExpr << ".addChangeCallback(this, std::bind(&SelfType::adjust, this, std::placeholders::_1));\n"
+		 << "\t\t_size = " << nodeExpr << ".size();\n"
+		 << "\t}\n\n"
+
+		 << "\tint rowCount(const QModelIndex &parent = {}) const override {\n"
+		 << "\t\treturn parent.isValid() ? 0 : _size;\n"
+		 << "\t}\n\n"
+
+		 << "\tQVariant data(const QModelIndex &index, int role) const override {\n"
+		 << "\t\tif(!isValidIndex(index))\n"
+		 << "\t\t\treturn {};\n"
+		 << "\t\tswitch(role) {\n"
+		 << "\t\tcase Qt::UserRole:\n"
+		 << "\t\t\treturn QVariant::fromValue(element(index.row()));\n";
+	for(auto i = 0; i < roles.size(); i++) {
+		_hdr << "\t\tcase Qt::UserRole + " << (i + 1) << ":\n"
+			 << "\t\t\treturn QVariant::fromValue(element(index.row())->get_" << roles[i]->key << "());\n";
+	}
+	_hdr << "\t\tdefault:\n"
+		 << "\t\t\treturn {};\n"
+		 << "\t\t}\n"
+		 << "\t}\n\n"
+
+		 << "\tbool setData(const QModelIndex &index, const QVariant &value, int role) override {\n"
+		 << "\t\tif(!isValidIndex(index))\n"
+		 << "\t\t\treturn false;\n"
+		 << "\t\tswitch(role) {\n";
+	for(auto i = 0; i < roles.size(); i++) {
+		_hdr << "\t\tcase Qt::UserRole + " << (i + 1) << ":\n"
+			 << "\t\t\telement(index.row())->set_" << roles[i]->key << "(value.value<" << _typeMappings.value(roles[i]->type, roles[i]->type) << ">());\n"
+			 << "\t\t\treturn true;\n";
+	}
+	_hdr << "\t\tdefault:\n"
+		 << "\t\t\treturn false;\n"
+		 << "\t\t}\n"
+		 << "\t}\n\n"
+
+		 << "\tQt::ItemFlags flags(const QModelIndex &index) const override {\n"
+		 << "\t\treturn QAbstractListModel::flags(index) | Qt::ItemIsEditable;\n"
+		 << "\t}\n\n"
+
+		 << "\tQHash<int, QByteArray> roleNames() const override {\n"
+		 << "\t\treturn {\n"
+		 << "\t\t\t{Qt::UserRole, \"element\"}";
+	for(auto i = 0; i < roles.size(); i++)
+		_hdr << ",\n\t\t\t{Qt::UserRole + " << (i + 1) << ", \"" << roles[i]->key << "\"}";
+	_hdr << "\n\t\t};\n"
+		 << "\t}\n\n"
+
+		 << "\tQ_INVOKABLE ElementType *at(int row) const {\n"
+		 << "\t\treturn row >= 0 && row < _size ? element(row) : nullptr;\n"
+		 << "\t}\n\n"
+
+		 << "\tQ_INVOKABLE ElementType *push() {\n"
+		 << "\t\tauto row = " << nodeExpr << ".size();\n"
+		 << "\t\t" << nodeExpr << ".push();\n"
+		 << "\t\tadjust(" << nodeExpr << ".size());\n"
+		 << "\t\treturn element(row);\n"
+		 << "\t}\n\n"
+
+		 << "\tQ_INVOKABLE void pop(int count = 1) {\n"
+		 << "\t\t" << nodeExpr << ".pop(count);\n"
+		 << "\t\tadjust(" << nodeExpr << ".size());\n"
+		 << "\t}\n\n"
+
+		 << "\tQ_INVOKABLE void reset() {\n"
+		 << "\t\t" << nodeExpr << ".reset();\n"
+		 << "\t\tadjust(0);\n"
+		 << "\t}\n\n"
+
+		 << "private:\n"
+		 << "\tbool isValidIndex(const QModelIndex &index) const {\n"
+		 << "\t\treturn index.isValid() &&\n"
+		 << "\t\t\t\t!index.parent().isValid() &&\n"
+		 << "\t\t\t\tindex.column() == 0 &&\n"
+		 << "\t\t\t\tindex.row() < _size;\n"
+		 << "\t}\n\n"
+
+		 << "\tElementType *element(int row) const {\n"
+		 << "\t\tif(_elements.size() <= row)\n"
+		 << "\t\t\t_elements.resize(row + 1);\n"
+		 << "\t\tauto &elem = _elements[row];\n"
+		 << "\t\tif(!elem) {\n"
+		 << "\t\t\tauto self = const_cast<SelfType*>(this);\n"
+		 << "\t\t\telem = new ElementType{_settings, _indexMap, row, self};\n";
+	for(auto i = 0; i < roles.size(); i++) {
+		_hdr << "\t\t\tQObject::connect(elem, &ElementType::" << roles[i]->key << "Changed, self, [self, row]() {\n"
+			 << "\t\t\t\tself->rowChanged(row, Qt::UserRole + " << (i + 1) << ");\n"
+			 << "\t\t\t});\n";
+	}
+	_hdr << "\t\t}\n"
+		 << "\t\treturn elem;\n"
+		 << "\t}\n\n"
+
+		 << "\tvoid rowChanged(int row, int role) {\n"
+		 << "\t\tconst auto mIndex = index(row);\n"
+		 << "\t\temit dataChanged(mIndex, mIndex, {role});\n"
+		 << "\t}\n\n"
+
+		 << "\tvoid adjust(int size) {\n"
+		 << "\t\tif(size > _size) {\n"
+		 << "\t\t\tbeginInsertRows({}, _size, size - 1);\n"
+		 << "\t\t\t_size = size;\n"
+		 << "\t\t\tendInsertRows();\n"
+		 << "\t\t} else if(size < _size) {\n"
+		 << "\t\t\tbeginRemoveRows({}, size, _size - 1);\n"
+		 << "\t\t\t_size = size;\n"
+		 << "\t\t\tfor(auto row = size; row < _elements.size(); row++) {\n"
+		 << "\t\t\t\tif(_elements[row])\n"
+		 << "\t\t\t\t\t_elements[row]->deleteLater();\n"
+		 << "\t\t\t}\n"
+		 << "\t\t\tif(_elements.size() > size)\n"
+		 << "\t\t\t\t_elements.resize(size);\n"
+		 << "\t\t\tendRemoveRows();\n"
+		 << "\t\t}\n"
+		 << "\t}\n"
+		 << "};\n\n";
+}
+
+void QmlSettingsGenerator::collectModelRoles(const NodeContentGroup &node, QList<const EntryType*> &roles) const
+{
+	// only the direct entries of a list element become roles, nested nodes are reached via the element role
+	for(const auto &cNode : node.contentNodes) {
+		if(nonstd::holds_alternative<EntryType>(cNode)) {
+			const auto &entry = nonstd::get<EntryType>(cNode);
+			if(_typeMappings.value(entry.type, entry.type) != QStringLiteral("void"))
+				roles.append(&entry);
+		} else if(nonstd::holds_alternative<NodeContentGroup>(cNode))
+			collectModelRoles(nonstd::get<NodeContentGroup>(cNode), roles);
+	}
+}
+
 void QmlSettingsGenerator::writeProperties(const NodeContentGroup &node, const QStringList &keyList, QList<int> &childOffsets, QList<int> &listEntries, QList<QPair<QString, int>> &childConstructs)
 {
 	for(const auto &cNode : node.contentNodes) {
@@ -284,6 +447,19 @@ void QmlSettingsGenerator::writeEntryProperty(const EntryType &entry, QStringLis
 
 void QmlSettingsGenerator::writeListNodeProperty(const ListNodeType &node, QStringList keyList, int classIndex, QList<QPair<QString, int>> &childConstructs)
 {
+	if(_listModels.contains(classIndex)) {
+		_hdr << "\tQ_PROPERTY(" << _name << "_ListModel_" << classIndex << "* " << node.key
+			 << " MEMBER _" << node.key << " CONSTANT)\n"
+			 << "\t" << _name << "_ListModel_" << classIndex << "* _" << node.key << ";\n"
+			 << "public:\n"
+			 << "\tQ_INVOKABLE " << _name << "_" << classIndex << " *" << node.key << "_push() {\n"
+			 << "\t\treturn _" << node.key << "->push();\n"
+			 << "\t}\n"
+			 << "private:\n\n";
+		childConstructs.append({node.key, classIndex});
+		return;
+	}
+
 	keyList.append(node.key);
 	_hdr << "\tusing ListData_" << classIndex << " = " << _name << "_ListData<" << _name << "_" << classIndex << ", SelfType, typename std::decay<decltype(_settings->" << keyList.join(QLatin1Char('.')) << ")>::type>;\n"
 		 << "\tfriend ListData_" << classIndex << ";\n"
@@ -319,6 +495,8 @@ void QmlSettingsGenerator::writeMemberInits(const QStringList &keyList, const QL
 	for(const auto &info : childConstructs) {
 		if(info.second < 0)
 			_hdr << "\t\t,_" << info.first << "{_settings->" << (QStringList{keyList} << info.first).join(QLatin1Char('.')) << ", {}}\n";
+		else if(_listModels.contains(info.second))
+			_hdr << "\t\t,_" << info.first << "{new " << _name << "_ListModel_" << info.second << "{_settings, _indexMap, this}}\n";
 		else
 			_hdr << "\t\t,_" << info.first << "{new " << _name << "_" << info.second << "{_settings, _indexMap, this}}\n";
 	}
@@ -355,6 +533,8 @@ void QmlSettingsGenerator::writeEntryPropertySignalConnect(const EntryType &entr
 void QmlSettingsGenerator::writeListNodePropertySignalConnect(const ListNodeType &entry, QStringList keyList, QList<int> &listEntries)
 {
 	auto classIndex = listEntries.takeFirst();
+	if(_listModels.contains(classIndex))
+		return; //list models track the size themselves
 	keyList.append(entry.key);
 	_hdr << "\t\t_settings->" << keyList.join(QLatin1Char('.'))
 		 << ".addChangeCallback(this, std::bind(&"
@@ -406,6 +586,10 @@ void QmlSettingsGenerator::writeQmlRegistration(QmlRegistrationMode mode, int ty
 		 << "\tconst QString msg{QStringLiteral(\"Settings-Helpertypes cannot be created\")};\n\n";
 	for(auto i = 0; i < typeNum; i++)
 		_src << "\tqmlRegisterUncreatableType<" << _name << "_" << i << ">(uri, major, minor, \"" << _name << "_" << i << "\", msg);\n";
+	auto listModels = _listModels.values();
+	std::sort(listModels.begin(), listModels.end());
+	for(auto i : qAsConst(listModels))
+		_src << "\tqmlRegisterUncreatableType<" << _name << "_ListModel_" << i << ">(uri, major, minor, \"" << _name << "_ListModel_" << i << "\", msg);\n";
 
 	switch(mode) {
 	case Singleton:
@@ -25,6 +25,7 @@ private:
 	QString _name;
 	QString _prefixName;
 	QHash<QString, QString> _typeMappings;
+	QSet<int> _listModels;
 
 	int writeHeader(const SettingsType &settings, const QString &inHdrPath);
 
@@ -33,6 +34,8 @@ private:
 	std::tuple<int, QList<int>> writeNodeContentClasses(const NodeContentGroup &node, const QStringList &keyList, int offset = 0, int listDepth = 0);
 	int writeNodeClass(const NodeType &node, QStringList keyList, int offset, int listDepth);
 	int writeListNodeClass(const ListNodeType &entry, QStringList keyList, int offset, int listDepth);
+	void writeListModelClass(const ListNodeType &node, const QStringList &keyList, int classIndex);
+	void collectModelRoles(const NodeContentGroup &node, QList<const EntryType*> &roles) const;
 
 	void writeProperties(const NodeContentGroup &node,
 						 const QStringList &keyList,